@@ -0,0 +1,309 @@
+#include "acquisition.hpp"
+#include "stm32l4xx_hal.h"
+#include <algorithm>
+#include <bit>
+#include <span>
+
+#ifdef ADXL345_LOW_POWER
+#include "low_power.hpp"
+#endif
+
+namespace Acquisition {
+
+    Acquisition::Acquisition(BusDevice&& bus_device,
+                             DMADevice&& dma_device,
+                             ADXL345::Config const& config) noexcept :
+        adxl345_{std::forward<BusDevice>(bus_device), std::forward<DMADevice>(dma_device), config}
+    {}
+
+    bool Acquisition::load_or_calibrate_offsets() noexcept
+    {
+        if (auto const offsets = CalibrationStorage::load_offsets(); offsets.has_value()) {
+            return this->adxl345_.set_offsets(*offsets);
+        }
+
+        auto const offsets = this->adxl345_.calibrate_offsets(CALIBRATION_SAMPLES,
+                                                              CALIBRATION_EXPECTED_MILLI_G,
+                                                              get_milliseconds,
+                                                              nullptr);
+        return offsets.has_value() && CalibrationStorage::store_offsets(*offsets);
+    }
+
+    bool Acquisition::register_event_handler(EventDispatcher::EventMask const event_mask,
+                                             EventDispatcher::EventHandler const handler,
+                                             void* const context) noexcept
+    {
+        return this->event_dispatcher_.register_handler(event_mask, handler, context);
+    }
+
+    bool Acquisition::start_streaming(std::uint8_t const watermark) noexcept
+    {
+        start_timestamp_counter();
+
+        auto const data_rate = this->adxl345_.get_data_rate();
+        if (!data_rate.has_value()) {
+            return false;
+        }
+
+        this->watermark_ = std::min(watermark, ADXL345::FIFO_MAX_WATERMARK);
+
+        auto capture_profile =
+            ActivityController::make_capture_profile(*data_rate, this->watermark_, ADXL345::InterruptPin::INT1);
+        auto idle_profile = ActivityController::make_idle_profile(ActivityController::DEFAULT_IDLE_DATA_RATE,
+                                                                  ADXL345::FIFO_MAX_WATERMARK,
+                                                                  ADXL345::InterruptPin::INT1);
+        capture_profile.int_enable =
+            EventDispatcher::enable_events(capture_profile.int_enable, this->event_dispatcher_.get_event_mask());
+        idle_profile.int_enable =
+            EventDispatcher::enable_events(idle_profile.int_enable, this->event_dispatcher_.get_event_mask());
+        this->activity_controller_ = ActivityController::ActivityController{capture_profile, idle_profile};
+
+        this->timestamp_reconstructor_ = TimestampReconstructor::TimestampReconstructor{
+            get_tick_frequency(),
+            ADXL345::data_rate_to_frequency(*data_rate)};
+        this->interrupt_pending_.store(false, std::memory_order_relaxed);
+
+        return this->adxl345_.start_fifo_streaming(ADXL345::FifoMode::STREAM,
+                                                   this->watermark_,
+                                                   ADXL345::InterruptPin::INT1) &&
+               this->adxl345_.set_activity_config(ACTIVITY_CONFIG) &&
+               this->adxl345_.set_power_profile(this->activity_controller_.get_profile());
+    }
+
+    void Acquisition::interrupt_callback() noexcept
+    {
+        if (!this->interrupt_pending_.load(std::memory_order_relaxed)) {
+            this->interrupt_timestamp_.store(get_timestamp(), std::memory_order_relaxed);
+        }
+        this->interrupt_pending_.store(true, std::memory_order_release);
+    }
+
+    void Acquisition::process() noexcept
+    {
+        while (this->drain_complete_.exchange(false, std::memory_order_acquire)) {
+            this->drain_active_ = false;
+            this->complete_pass();
+        }
+
+        if (this->drain_active_ || !this->interrupt_pending_.load(std::memory_order_acquire)) {
+            return;
+        }
+
+        this->pass_timestamp_ = this->interrupt_timestamp_.load(std::memory_order_relaxed);
+        this->interrupt_pending_.store(false, std::memory_order_release);
+
+        this->pass_ = 0UZ;
+        this->start_pass();
+    }
+
+    std::span<Block const> Acquisition::get_blocks() const noexcept
+    {
+        return this->blocks_.get_pop_span();
+    }
+
+    void Acquisition::release_blocks(std::size_t const count) noexcept
+    {
+        this->blocks_.commit_pop(count);
+    }
+
+    float Acquisition::get_sample_rate() const noexcept
+    {
+        return this->timestamp_reconstructor_.get_rate_estimator().get_sample_rate();
+    }
+
+    ActivityController::Mode Acquisition::get_mode() const noexcept
+    {
+        return this->activity_controller_.get_mode();
+    }
+
+    LossStatistics const& Acquisition::get_loss_statistics() const noexcept
+    {
+        return this->loss_statistics_;
+    }
+
+    float Acquisition::get_nominal_sample_rate() const noexcept
+    {
+        return this->timestamp_reconstructor_.get_rate_estimator().get_nominal_rate();
+    }
+
+    std::uint8_t Acquisition::get_watermark() const noexcept
+    {
+        return this->watermark_;
+    }
+
+    bool Acquisition::has_pending_work() const noexcept
+    {
+        return this->interrupt_pending_.load(std::memory_order_acquire) ||
+               this->drain_complete_.load(std::memory_order_acquire) || !this->blocks_.is_empty();
+    }
+
+    bool Acquisition::is_draining() const noexcept
+    {
+        return this->drain_active_;
+    }
+
+    void Acquisition::drain_callback(void* const context, std::optional<std::size_t> const drained) noexcept
+    {
+        auto* const acquisition = static_cast<Acquisition*>(context);
+        acquisition->drained_ = drained.value_or(0UZ);
+        acquisition->drain_complete_.store(true, std::memory_order_release);
+    }
+
+    void Acquisition::start_pass() noexcept
+    {
+        auto const int_source = this->adxl345_.get_interrupt_source();
+        if (!int_source.has_value()) {
+            this->interrupt_pending_.store(true, std::memory_order_release);
+            return;
+        }
+
+        if (this->pass_ > 0UZ && !this->is_interrupt_asserted(*int_source)) {
+            return;
+        }
+
+        this->int_source_ = *int_source;
+        if (int_source->overrun == 1U) {
+            this->recover_overrun();
+        } else if (int_source->watermark == 1U && this->pass_ == 0UZ) {
+            this->timestamp_reconstructor_.capture(this->pass_timestamp_, this->watermark_);
+        }
+
+        auto& block = this->acquire_block();
+        this->drain_active_ = true;
+        if (!this->adxl345_.drain_fifo_block_async(block.samples, &Acquisition::drain_callback, this)) {
+            this->drain_active_ = false;
+            this->drained_ = this->adxl345_.drain_fifo_block(block.samples).value_or(0UZ);
+            this->complete_pass();
+        }
+    }
+
+    void Acquisition::complete_pass() noexcept
+    {
+        this->commit_block(this->drained_);
+
+        auto const act_tap_status = EventDispatcher::needs_act_tap_status(this->int_source_)
+                                        ? this->adxl345_.get_activity_tap_status()
+                                        : std::optional<ADXL345::ACT_TAP_STATUS>{std::nullopt};
+        this->event_dispatcher_.decode(this->int_source_, act_tap_status, this->pass_timestamp_);
+
+        if (auto const power_profile = this->activity_controller_.update(this->int_source_);
+            power_profile.has_value()) {
+            this->apply_power_profile(*power_profile);
+        }
+
+        this->event_dispatcher_.dispatch();
+
+        this->pass_timestamp_ = get_timestamp();
+        if (++this->pass_ < MAX_INTERRUPT_PASSES) {
+            this->start_pass();
+        } else {
+            this->interrupt_pending_.store(true, std::memory_order_release);
+        }
+    }
+
+    bool Acquisition::is_interrupt_asserted(ADXL345::INT_SOURCE const& int_source) const noexcept
+    {
+        return (std::bit_cast<std::uint8_t>(int_source) &
+                std::bit_cast<std::uint8_t>(this->activity_controller_.get_profile().int_enable)) != 0U;
+    }
+
+    void Acquisition::recover_overrun() noexcept
+    {
+        auto const entries = this->adxl345_.get_fifo_entries().value_or(ADXL345::FIFO_SIZE);
+        auto const lost = this->timestamp_reconstructor_.recover(get_timestamp(), entries);
+
+        ++this->loss_statistics_.overruns;
+        this->loss_statistics_.lost_samples += lost;
+        this->gap_pending_ = true;
+    }
+
+    void Acquisition::drain_samples() noexcept
+    {
+        auto& block = this->acquire_block();
+        this->commit_block(this->adxl345_.drain_fifo_block(block.samples).value_or(0UZ));
+    }
+
+    Block& Acquisition::acquire_block() noexcept
+    {
+        auto const push_span = this->blocks_.get_push_span();
+        this->block_ = push_span.empty() ? &this->scratch_block_ : &push_span.front();
+        this->block_->samples.clear();
+        return *this->block_;
+    }
+
+    void Acquisition::commit_block(std::size_t const drained) noexcept
+    {
+        auto& block = *this->block_;
+
+        auto const timestamps = std::span{block.timestamps}.first(drained);
+        auto const timed = this->timestamp_reconstructor_.reconstruct(timestamps);
+        if (!timed) {
+            std::ranges::fill(timestamps, get_timestamp());
+        }
+
+        if (drained == 0UZ) {
+            return;
+        }
+
+        if (this->block_ == &this->scratch_block_) {
+            this->loss_statistics_.dropped_samples += static_cast<std::uint32_t>(drained);
+            this->gap_pending_ = true;
+            return;
+        }
+
+        block.gap = this->gap_pending_ || !timed;
+        if (block.gap) {
+            ++this->loss_statistics_.gaps;
+            this->gap_pending_ = false;
+        }
+        this->blocks_.commit_push(1UZ);
+    }
+
+    bool Acquisition::apply_power_profile(ActivityController::PowerProfile const& power_profile) noexcept
+    {
+        this->drain_samples();
+        if (!this->adxl345_.set_power_profile(power_profile)) {
+            return false;
+        }
+
+        this->watermark_ = power_profile.fifo_ctl.samples;
+        this->timestamp_reconstructor_.set_sample_rate(
+            ADXL345::data_rate_to_frequency(static_cast<ADXL345::DataRate>(power_profile.bw_rate.rate)));
+        return true;
+    }
+
+    void Acquisition::start_timestamp_counter() noexcept
+    {
+#ifdef ADXL345_LOW_POWER
+        LowPower::start_tick_timer();
+#else
+        CoreDebug->DEMCR = CoreDebug->DEMCR | CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CYCCNT = 0U;
+        DWT->CTRL = DWT->CTRL | DWT_CTRL_CYCCNTENA_Msk;
+#endif
+    }
+
+    std::uint32_t Acquisition::get_timestamp() noexcept
+    {
+#ifdef ADXL345_LOW_POWER
+        return static_cast<std::uint32_t>(LowPower::get_ticks());
+#else
+        return DWT->CYCCNT;
+#endif
+    }
+
+    std::uint32_t Acquisition::get_tick_frequency() noexcept
+    {
+#ifdef ADXL345_LOW_POWER
+        return LowPower::TICK_FREQUENCY;
+#else
+        return SystemCoreClock;
+#endif
+    }
+
+    std::uint32_t Acquisition::get_milliseconds(void* const) noexcept
+    {
+        return HAL_GetTick();
+    }
+
+}; // namespace Acquisition
@@ -0,0 +1,167 @@
+#ifndef ACQUISITION_HPP
+#define ACQUISITION_HPP
+
+#include "activity_controller.hpp"
+#include "adxl345.hpp"
+#include "calibration_storage.hpp"
+#include "event_dispatcher.hpp"
+#include "ring_buffer.hpp"
+#include "timestamp_reconstructor.hpp"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <span>
+
+#ifdef ADXL345_SPI
+#include "spi_bus_device.hpp"
+#else
+#include "i2c_bus_scheduler.hpp"
+#endif
+
+namespace Acquisition {
+
+#ifdef ADXL345_SPI
+    using BusDevice = ::SPIBusDevice::SPIBusDevice;
+    using DMADevice = ::SPIBusDevice::SPIBusDevice;
+#else
+    using BusDevice = ::I2CBusScheduler::I2CScheduledDevice;
+    using DMADevice = ::I2CBusScheduler::I2CScheduledDevice;
+#endif
+
+    using Sensor = ADXL345::ADXL345<BusDevice, DMADevice>;
+
+    using SampleBlock = ADXL345::SampleBlock<std::int16_t, ADXL345::FIFO_SIZE>;
+
+    struct Block {
+        SampleBlock samples{};
+        std::array<std::uint32_t, ADXL345::FIFO_SIZE> timestamps{};
+        bool gap{};
+    };
+
+    struct LossStatistics {
+        std::uint32_t overruns{};
+        std::uint64_t lost_samples{};
+        std::uint32_t dropped_samples{};
+        std::uint32_t gaps{};
+    };
+
+    std::size_t constexpr BLOCK_BUFFER_SIZE = 16UZ;
+
+    using BlockBuffer = RingBuffer::RingBuffer<Block, BLOCK_BUFFER_SIZE>;
+
+    std::uint8_t constexpr DEFAULT_WATERMARK = 16U;
+
+    std::size_t constexpr MAX_INTERRUPT_PASSES = 4UZ;
+
+    std::size_t constexpr CALIBRATION_SAMPLES = 64UZ;
+    ADXL345::Vec3D<std::int32_t> constexpr CALIBRATION_EXPECTED_MILLI_G = {0, 0, ADXL345::MILLI_G_PER_G};
+
+    ADXL345::ActivityConfig constexpr ACTIVITY_CONFIG = {.thresh_act = {.thresh_act = 4U},
+                                                         .thresh_inact = {.thresh_inact = 2U},
+                                                         .time_inact = {.time_inact = 10U},
+                                                         .act_inact_ctl = {.inact_z_en = 1U,
+                                                                           .inact_y_en = 1U,
+                                                                           .inact_x_en = 1U,
+                                                                           .inact_ac_dc = 1U,
+                                                                           .act_z_en = 1U,
+                                                                           .act_y_en = 1U,
+                                                                           .act_x_en = 1U,
+                                                                           .act_ac_dc = 1U}};
+
+    struct Acquisition {
+    public:
+        Acquisition() noexcept = default;
+        Acquisition(BusDevice&& bus_device, DMADevice&& dma_device, ADXL345::Config const& config) noexcept;
+
+        Acquisition(Acquisition const& other) = delete;
+        Acquisition(Acquisition&& other) = delete;
+
+        Acquisition& operator=(Acquisition const& other) = delete;
+        Acquisition& operator=(Acquisition&& other) = delete;
+
+        ~Acquisition() noexcept = default;
+
+        bool load_or_calibrate_offsets() noexcept;
+
+        bool register_event_handler(EventDispatcher::EventMask const event_mask,
+                                    EventDispatcher::EventHandler const handler,
+                                    void* const context) noexcept;
+
+        bool start_streaming(std::uint8_t const watermark = DEFAULT_WATERMARK) noexcept;
+
+        void interrupt_callback() noexcept;
+
+        void process() noexcept;
+
+        std::span<Block const> get_blocks() const noexcept;
+        void release_blocks(std::size_t const count) noexcept;
+
+        float get_sample_rate() const noexcept;
+
+        ActivityController::Mode get_mode() const noexcept;
+
+        LossStatistics const& get_loss_statistics() const noexcept;
+
+        float get_nominal_sample_rate() const noexcept;
+        std::uint8_t get_watermark() const noexcept;
+
+        bool has_pending_work() const noexcept;
+        bool is_draining() const noexcept;
+
+    private:
+        static void drain_callback(void* const context, std::optional<std::size_t> const drained) noexcept;
+
+        void start_pass() noexcept;
+        void complete_pass() noexcept;
+
+        bool is_interrupt_asserted(ADXL345::INT_SOURCE const& int_source) const noexcept;
+
+        void recover_overrun() noexcept;
+
+        void drain_samples() noexcept;
+
+        Block& acquire_block() noexcept;
+        void commit_block(std::size_t const drained) noexcept;
+
+        bool apply_power_profile(ActivityController::PowerProfile const& power_profile) noexcept;
+
+        static void start_timestamp_counter() noexcept;
+        static std::uint32_t get_timestamp() noexcept;
+        static std::uint32_t get_tick_frequency() noexcept;
+        static std::uint32_t get_milliseconds(void* const context) noexcept;
+
+        Sensor adxl345_{};
+
+        BlockBuffer blocks_{};
+
+        TimestampReconstructor::TimestampReconstructor timestamp_reconstructor_{};
+
+        Block* block_{nullptr};
+        Block scratch_block_{};
+
+        ActivityController::ActivityController activity_controller_{};
+
+        EventDispatcher::EventDispatcher event_dispatcher_{};
+
+        std::uint8_t watermark_{};
+
+        LossStatistics loss_statistics_{};
+
+        bool gap_pending_{false};
+
+        ADXL345::INT_SOURCE int_source_{};
+        std::uint32_t pass_timestamp_{};
+        std::size_t pass_{};
+
+        std::size_t drained_{};
+        bool drain_active_{false};
+        std::atomic<bool> drain_complete_{false};
+
+        std::atomic<std::uint32_t> interrupt_timestamp_{};
+        std::atomic<bool> interrupt_pending_{false};
+    };
+
+}; // namespace Acquisition
+
+#endif // ACQUISITION_HPP
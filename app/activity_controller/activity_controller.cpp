@@ -0,0 +1,106 @@
+#include "activity_controller.hpp"
+#include <algorithm>
+#include <bit>
+#include <utility>
+
+namespace ActivityController {
+
+    namespace {
+
+        ADXL345::INT_MAP make_int_map(ADXL345::InterruptPin const interrupt_pin) noexcept
+        {
+            return std::bit_cast<ADXL345::INT_MAP>(interrupt_pin == ADXL345::InterruptPin::INT2 ? std::uint8_t{0xFFU}
+                                                                                                : std::uint8_t{0x00U});
+        }
+
+        ADXL345::FIFO_CTL make_fifo_ctl(std::uint8_t const watermark) noexcept
+        {
+            return ADXL345::FIFO_CTL{
+                .samples = static_cast<std::uint8_t>(std::min(watermark, ADXL345::FIFO_MAX_WATERMARK) & 0x1FU),
+                .trigger = 0U,
+                .fifo_mode = std::to_underlying(ADXL345::FifoMode::STREAM)};
+        }
+
+    }; // namespace
+
+    PowerProfile make_capture_profile(ADXL345::DataRate const data_rate,
+                                      std::uint8_t const watermark,
+                                      ADXL345::InterruptPin const interrupt_pin) noexcept
+    {
+        return PowerProfile{
+            .bw_rate = {.rate = static_cast<std::uint8_t>(std::to_underlying(data_rate) & 0xFU), .low_power = 0U},
+            .power_ctl = {.wakeup = 0U, .sleep = 0U, .measure = 1U, .auto_sleep = 0U, .link = 1U},
+            .int_enable = {.overrun = 0U,
+                           .watermark = 1U,
+                           .free_fall = 0U,
+                           .inactivity = 1U,
+                           .activity = 0U,
+                           .double_tap = 0U,
+                           .single_tap = 0U,
+                           .data_ready = 0U},
+            .int_map = make_int_map(interrupt_pin),
+            .fifo_ctl = make_fifo_ctl(watermark)};
+    }
+
+    PowerProfile make_idle_profile(ADXL345::DataRate const data_rate,
+                                   std::uint8_t const watermark,
+                                   ADXL345::InterruptPin const interrupt_pin) noexcept
+    {
+        return PowerProfile{
+            .bw_rate = {.rate = static_cast<std::uint8_t>(std::to_underlying(data_rate) & 0xFU),
+                        .low_power = static_cast<std::uint8_t>(ADXL345::is_low_power_data_rate(data_rate) ? 1U : 0U)},
+            .power_ctl = {.wakeup = 0U, .sleep = 0U, .measure = 1U, .auto_sleep = 0U, .link = 1U},
+            .int_enable = {.overrun = 0U,
+                           .watermark = 1U,
+                           .free_fall = 0U,
+                           .inactivity = 0U,
+                           .activity = 1U,
+                           .double_tap = 0U,
+                           .single_tap = 0U,
+                           .data_ready = 0U},
+            .int_map = make_int_map(interrupt_pin),
+            .fifo_ctl = make_fifo_ctl(watermark)};
+    }
+
+    ActivityController::ActivityController(PowerProfile const& capture_profile,
+                                           PowerProfile const& idle_profile) noexcept :
+        capture_profile_{capture_profile}, idle_profile_{idle_profile}
+    {}
+
+    std::optional<PowerProfile> ActivityController::update(ADXL345::INT_SOURCE const int_source) noexcept
+    {
+        auto const mode = int_source.activity == 1U     ? Mode::CAPTURE
+                          : int_source.inactivity == 1U ? Mode::IDLE
+                                                        : this->mode_;
+        if (mode == this->mode_) {
+            return std::nullopt;
+        }
+
+        this->mode_ = mode;
+        ++this->transitions_;
+
+        return this->get_profile();
+    }
+
+    void ActivityController::reset() noexcept
+    {
+        this->mode_ = Mode::CAPTURE;
+        this->transitions_ = 0U;
+    }
+
+    Mode ActivityController::get_mode() const noexcept
+    {
+        return this->mode_;
+    }
+
+    PowerProfile const& ActivityController::get_profile() const noexcept
+    {
+        return this->mode_ == Mode::CAPTURE ? this->capture_profile_ : this->idle_profile_;
+    }
+
+    std::uint32_t ActivityController::get_transitions() const noexcept
+    {
+        return this->transitions_;
+    }
+
+}; // namespace ActivityController
@@ -0,0 +1,61 @@
+#ifndef ACTIVITY_CONTROLLER_HPP
+#define ACTIVITY_CONTROLLER_HPP
+
+#include "adxl345_config.hpp"
+#include "adxl345_registers.hpp"
+#include <cstdint>
+#include <optional>
+
+namespace ActivityController {
+
+    using PowerProfile = ADXL345::PowerProfile;
+
+    enum struct Mode : std::uint8_t {
+        CAPTURE,
+        IDLE,
+    };
+
+    ADXL345::DataRate constexpr DEFAULT_IDLE_DATA_RATE = ADXL345::DataRate::RATE_12HZ5;
+
+    PowerProfile make_capture_profile(ADXL345::DataRate const data_rate,
+                                      std::uint8_t const watermark,
+                                      ADXL345::InterruptPin const interrupt_pin) noexcept;
+
+    PowerProfile make_idle_profile(ADXL345::DataRate const data_rate,
+                                   std::uint8_t const watermark,
+                                   ADXL345::InterruptPin const interrupt_pin) noexcept;
+
+    struct ActivityController {
+    public:
+        ActivityController() noexcept = default;
+        ActivityController(PowerProfile const& capture_profile, PowerProfile const& idle_profile) noexcept;
+
+        ActivityController(ActivityController const& other) noexcept = default;
+        ActivityController(ActivityController&& other) noexcept = default;
+
+        ActivityController& operator=(ActivityController const& other) noexcept = default;
+        ActivityController& operator=(ActivityController&& other) noexcept = default;
+
+        ~ActivityController() noexcept = default;
+
+        std::optional<PowerProfile> update(ADXL345::INT_SOURCE const int_source) noexcept;
+
+        void reset() noexcept;
+
+        Mode get_mode() const noexcept;
+        PowerProfile const& get_profile() const noexcept;
+
+        std::uint32_t get_transitions() const noexcept;
+
+    private:
+        PowerProfile capture_profile_{};
+        PowerProfile idle_profile_{};
+
+        Mode mode_{Mode::CAPTURE};
+
+        std::uint32_t transitions_{};
+    };
+
+}; // namespace ActivityController
+
+#endif // ACTIVITY_CONTROLLER_HPP
@@ -2,23 +2,40 @@
 #define ADXL345_HPP
 
 #include "adxl345_config.hpp"
+#include "adxl345_register_map.hpp"
 #include "adxl345_registers.hpp"
-#include "i2c_device.hpp"
+#include "adxl345_transport.hpp"
+#include "scale_kernel.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <span>
+#include <utility>
 
 namespace ADXL345 {
 
+    template <BusDevice Bus, DMADevice DMA = NullDMADevice>
     struct ADXL345 {
     public:
-        using I2CDevice = Utility::I2CDevice;
+        using DrainCallback = void (*)(void* const context, std::optional<std::size_t> const drained) noexcept;
 
         ADXL345() noexcept = default;
-        ADXL345(I2CDevice&& i2c_device, Config const& config) noexcept;
+        ADXL345(Bus&& bus_device, Config const& config) noexcept;
+        ADXL345(Bus&& bus_device, DMA&& dma_device, Config const& config) noexcept;
 
         ADXL345(ADXL345 const& other) = delete;
-        ADXL345(ADXL345&& other) noexcept = default;
+        ADXL345(ADXL345&& other) = delete;
 
         ADXL345& operator=(ADXL345 const& other) = delete;
-        ADXL345& operator=(ADXL345&& other) noexcept = default;
+        ADXL345& operator=(ADXL345&& other) = delete;
 
         ~ADXL345() noexcept;
 
@@ -27,16 +44,109 @@ namespace ADXL345 {
         std::optional<float> get_acceleration_z_scaled() const noexcept;
         std::optional<Vec3D<float>> get_acceleration_scaled() const noexcept;
 
+        std::optional<std::int32_t> get_acceleration_x_milli_g() const noexcept;
+        std::optional<std::int32_t> get_acceleration_y_milli_g() const noexcept;
+        std::optional<std::int32_t> get_acceleration_z_milli_g() const noexcept;
+        std::optional<Vec3D<std::int32_t>> get_acceleration_milli_g() const noexcept;
+
+        bool start_fifo_streaming(FifoMode const fifo_mode,
+                                  std::uint8_t const watermark,
+                                  InterruptPin const interrupt_pin) const noexcept;
+        bool stop_fifo_streaming() const noexcept;
+
+        std::optional<std::size_t> get_fifo_entries() const noexcept;
+
+        std::optional<std::size_t> drain_fifo_raw(std::span<Vec3D<std::int16_t>> const samples) const noexcept;
+        std::optional<std::size_t> drain_fifo_scaled(std::span<Vec3D<float>> const samples) const noexcept;
+        std::optional<std::size_t> drain_fifo_milli_g(std::span<Vec3D<std::int32_t>> const samples) const noexcept;
+
+        template <std::size_t SIZE>
+        std::optional<std::size_t> drain_fifo_block(SampleBlock<std::int16_t, SIZE>& block) const noexcept;
+
+        template <std::size_t SIZE>
+        bool drain_fifo_block_async(SampleBlock<std::int16_t, SIZE>& block,
+                                    DrainCallback const callback,
+                                    void* const context) noexcept;
+
+        bool is_draining() const noexcept;
+
+        bool set_data_rate(DataRate const data_rate) const noexcept;
+        std::optional<DataRate> get_data_rate() const noexcept;
+
+        bool set_activity_config(ActivityConfig const& activity_config) const noexcept;
+        bool set_power_profile(PowerProfile const& power_profile) const noexcept;
+
+        std::optional<INT_SOURCE> get_interrupt_source() const noexcept;
+        std::optional<ACT_TAP_STATUS> get_activity_tap_status() const noexcept;
+
+        bool set_offsets(Vec3D<std::int8_t> const& offsets) const noexcept;
+        std::optional<Vec3D<std::int8_t>> get_offsets() const noexcept;
+
+        std::optional<Vec3D<std::int8_t>>
+        calibrate_offsets(std::size_t const sample_count,
+                          Vec3D<std::int32_t> const& expected_milli_g,
+                          Clock const clock,
+                          void* const clock_context,
+                          std::uint32_t const timeout_ms = CALIBRATION_TIMEOUT_MS) const noexcept;
+
+        bool resync_registers() noexcept;
+        bool verify_registers() const noexcept;
+
+        void set_max_retries(std::uint8_t const max_retries) noexcept;
+
+        TransportStatistics const& get_transport_statistics() const noexcept;
+        void clear_transport_statistics() noexcept;
+
     private:
-        std::uint8_t read_byte(std::uint8_t const reg_address) const noexcept;
+        static std::uint8_t constexpr SHADOW_FIRST_REG_ADDRESS = REG_ADDRESS<THRESH_TAP>;
+        static std::size_t constexpr SHADOW_SIZE = REG_ADDRESS<FIFO_CTL> - SHADOW_FIRST_REG_ADDRESS + 1UZ;
+
+        Expected<std::array<std::uint8_t, SHADOW_SIZE>> read_shadowed_registers() const noexcept;
+
+        static Vec3D<std::int16_t> data_to_raw(DATA const& data) noexcept;
+
+        static std::size_t constexpr DRAIN_ENTRY_SIZE = IS_FAST_BURST<DMA> ? sizeof(DATA) : sizeof(FIFO_DATA);
+
+        std::optional<Vec3D<std::int16_t>> pop_fifo_entry(std::size_t& entries) const noexcept;
+
+        template <std::size_t SIZE>
+        static void drain_status_callback(void* const context, std::span<std::uint8_t const> const bytes) noexcept;
 
         template <std::size_t SIZE>
-        std::array<std::uint8_t, SIZE> read_bytes(std::uint8_t const reg_address) const noexcept;
+        static void drain_data_callback(void* const context, std::span<std::uint8_t const> const bytes) noexcept;
 
-        void write_byte(std::uint8_t const reg_address, std::uint8_t const byte) const noexcept;
+        template <std::size_t SIZE>
+        bool submit_drain_status_read() noexcept;
 
         template <std::size_t SIZE>
-        void write_bytes(std::uint8_t const reg_address, std::array<std::uint8_t, SIZE> const& bytes) const noexcept;
+        void continue_drain() noexcept;
+
+        bool submit_drain_read(std::uint8_t const reg_address,
+                               std::size_t const size,
+                               TransferCallback const callback) noexcept;
+        bool retry_drain_read() noexcept;
+        void finish_drain(bool const success) noexcept;
+
+        template <std::invocable Transfer>
+        std::invoke_result_t<Transfer> transfer_with_retry(Transfer&& transfer) const noexcept;
+
+        Expected<std::uint8_t> read_byte(std::uint8_t const reg_address) const noexcept;
+
+        Expected<void> read_bytes(std::uint8_t const reg_address, std::span<std::uint8_t> const bytes) const noexcept;
+
+        Expected<void> write_byte(std::uint8_t const reg_address, std::uint8_t const byte) const noexcept;
+
+        Expected<void> write_bytes(std::uint8_t const reg_address,
+                                   std::span<std::uint8_t const> const bytes) const noexcept;
+
+        template <Readable Register>
+        Expected<Register> read() const noexcept;
+
+        template <Writable Register, Writable... Registers>
+        Expected<void> write(Register const reg, Registers const... regs) const noexcept;
+
+        template <Writable Register, std::invocable<Register&> Modifier>
+        Expected<void> modify(Modifier&& modifier) const noexcept;
 
         void initialize(Config const& config) noexcept;
 
@@ -44,109 +154,889 @@ namespace ADXL345 {
 
         bool is_valid_device_id() const noexcept;
 
-        std::uint8_t get_device_id() const noexcept;
+        Expected<std::uint8_t> get_device_id() const noexcept;
 
         std::optional<std::int16_t> get_acceleration_x_raw() const noexcept;
         std::optional<std::int16_t> get_acceleration_y_raw() const noexcept;
         std::optional<std::int16_t> get_acceleration_z_raw() const noexcept;
         std::optional<Vec3D<std::int16_t>> get_acceleration_raw() const noexcept;
 
-        DEVID get_devid_register() const noexcept;
+        bool initialized_{false};
 
-        THRESH_TAP get_thresh_tap_register() const noexcept;
-        void set_thresh_tap_register(THRESH_TAP const thresh_tap) const noexcept;
+        float scale_{};
 
-        OFSX get_ofsx_register() const noexcept;
-        void set_ofsx_register(OFSX const ofsx) const noexcept;
+        std::uint8_t lsb_shift_{};
 
-        OFSY get_ofsy_register() const noexcept;
-        void set_ofsy_register(OFSY const ofsy) const noexcept;
+        Bus bus_device_{};
 
-        OFSZ get_ofsz_register() const noexcept;
-        void set_ofsz_register(OFSZ const ofsz) const noexcept;
+        DMA dma_device_{};
 
-        DUR get_dur_register() const noexcept;
-        void set_dur_register(DUR const dur) const noexcept;
+        std::array<std::uint8_t, sizeof(FIFO_DATA)> drain_buffer_{};
 
-        LATENT get_latent_register() const noexcept;
-        void set_latent_register(LATENT const latent) const noexcept;
+        void* drain_block_{nullptr};
 
-        WINDOW get_window_register() const noexcept;
-        void set_window_register(WINDOW const window) const noexcept;
+        DrainCallback drain_callback_{nullptr};
 
-        THRESH_ACT get_thresh_act_register() const noexcept;
-        void set_thresh_act_register(THRESH_ACT const thresh_act) const noexcept;
+        void* drain_context_{nullptr};
 
-        THRESH_INACT get_thresh_inact_register() const noexcept;
-        void set_thresh_inact_register(THRESH_INACT const thresh_inact) const noexcept;
+        std::uint8_t drain_reg_address_{};
+        std::size_t drain_size_{};
+        TransferCallback drain_transfer_callback_{nullptr};
 
-        TIME_INACT get_time_inact_register() const noexcept;
-        void set_time_inact_register(TIME_INACT const time_inact) const noexcept;
+        std::size_t drain_entries_{};
+        std::size_t drained_{};
+        std::uint8_t drain_retries_{};
+        bool drain_status_valid_{false};
 
-        ACT_INACT_CTL get_act_inact_ctl_register() const noexcept;
-        void set_act_inact_ctl_register(ACT_INACT_CTL const act_inact_ctl) const noexcept;
+        std::atomic<bool> draining_{false};
 
-        THRESH_FF get_thresh_ff_register() const noexcept;
-        void set_thresh_ff_register(THRESH_FF const thresh_ff) const noexcept;
+        mutable std::array<std::uint8_t, SHADOW_SIZE> shadow_{};
 
-        TIME_FF get_time_ff_register() const noexcept;
-        void set_time_ff_register(TIME_FF const time_ff) const noexcept;
+        mutable bool shadow_valid_{false};
 
-        TAP_AXES get_tap_axes_register() const noexcept;
-        void set_tap_axes_register(TAP_AXES const tap_axes) const noexcept;
+        std::uint8_t max_retries_{DEFAULT_MAX_RETRIES};
 
-        ACT_TAP_STATUS get_act_tap_status_register() const noexcept;
+        mutable TransportStatistics transport_statistics_{};
+    };
 
-        BW_RATE get_bw_rate_register() const noexcept;
-        void set_bw_rate_register(BW_RATE const bw_rate) const noexcept;
+    template <BusDevice Bus, DMADevice DMA>
+    template <std::invocable Transfer>
+    inline std::invoke_result_t<Transfer> ADXL345<Bus, DMA>::transfer_with_retry(Transfer&& transfer) const noexcept
+    {
+        ++this->transport_statistics_.transactions;
 
-        POWER_CTL get_power_ctl_register() const noexcept;
-        void set_power_ctl_register(POWER_CTL const power_ctl) const noexcept;
+        auto result = std::invoke(transfer);
+        for (auto retry = 0U; !result.has_value() && retry < this->max_retries_; ++retry) {
+            ++this->transport_statistics_.retries;
+            result = std::invoke(transfer);
+        }
 
-        INT_ENABLE get_int_enable_register() const noexcept;
-        void set_int_enable_register(INT_ENABLE const int_enable) const noexcept;
+        if (!result.has_value()) {
+            ++this->transport_statistics_.failures;
+        }
 
-        INT_MAP get_int_map_register() const noexcept;
-        void set_int_map_register(INT_MAP const int_map) const noexcept;
+        return result;
+    }
 
-        INT_SOURCE get_int_source_register() const noexcept;
+    template <BusDevice Bus, DMADevice DMA>
+    template <Readable Register>
+    inline Expected<Register> ADXL345<Bus, DMA>::read() const noexcept
+    {
+        if constexpr (Writable<Register>) {
+            if (this->shadow_valid_) {
+                return std::bit_cast<Register>(this->shadow_[REG_ADDRESS<Register> - SHADOW_FIRST_REG_ADDRESS]);
+            }
+        }
 
-        DATA_FORMAT get_data_format_register() const noexcept;
-        void set_data_format_register(DATA_FORMAT const data_format) const noexcept;
+        if constexpr (sizeof(Register) == sizeof(std::uint8_t)) {
+            auto const byte = this->read_byte(REG_ADDRESS<Register>);
+            return byte.has_value() ? Expected<Register>{std::bit_cast<Register>(*byte)}
+                                    : Expected<Register>{::BusError::Unexpected{byte.error()}};
+        } else {
+            std::array<std::uint8_t, sizeof(Register)> bytes{};
+            auto const result = this->read_bytes(REG_ADDRESS<Register>, bytes);
+            return result.has_value() ? Expected<Register>{std::bit_cast<Register>(bytes)}
+                                      : Expected<Register>{::BusError::Unexpected{result.error()}};
+        }
+    }
 
-        DATA_X get_data_x_registers() const noexcept;
+    template <BusDevice Bus, DMADevice DMA>
+    template <Writable Register, Writable... Registers>
+    inline Expected<void> ADXL345<Bus, DMA>::write(Register const reg, Registers const... regs) const noexcept
+    {
+        static_assert(is_contiguous<Register, Registers...>());
 
-        DATA_Y get_data_y_registers() const noexcept;
+        auto constexpr SHADOW_INDEX = REG_ADDRESS<Register> - SHADOW_FIRST_REG_ADDRESS;
 
-        DATA_Z get_data_z_registers() const noexcept;
+        std::array<std::uint8_t, 1UZ + sizeof...(Registers)> const bytes{std::bit_cast<std::uint8_t>(reg),
+                                                                         std::bit_cast<std::uint8_t>(regs)...};
 
-        DATA get_data_registers() const noexcept;
+        if constexpr (sizeof...(Registers) == 0UZ) {
+            if (this->shadow_valid_ && this->shadow_[SHADOW_INDEX] == bytes[0]) {
+                return {};
+            }
+        }
 
-        FIFO_CTL get_fifo_ctl_register() const noexcept;
-        void set_fifo_ctl_register(FIFO_CTL const fifo_ctl) const noexcept;
+        auto const result = sizeof...(Registers) == 0UZ ? this->write_byte(REG_ADDRESS<Register>, bytes[0])
+                                                        : this->write_bytes(REG_ADDRESS<Register>, bytes);
+        if (result.has_value()) {
+            std::copy(bytes.begin(), bytes.end(), std::next(this->shadow_.begin(), SHADOW_INDEX));
+        } else {
+            this->shadow_valid_ = false;
+        }
 
-        FIFO_STATUS get_fifo_status_register() const noexcept;
+        return result;
+    }
 
-        bool initialized_{false};
+    template <BusDevice Bus, DMADevice DMA>
+    template <Writable Register, std::invocable<Register&> Modifier>
+    inline Expected<void> ADXL345<Bus, DMA>::modify(Modifier&& modifier) const noexcept
+    {
+        auto reg = this->read<Register>();
+        if (!reg.has_value()) {
+            return ::BusError::Unexpected{reg.error()};
+        }
 
-        float scale_{};
+        std::invoke(std::forward<Modifier>(modifier), *reg);
+        return this->write(*reg);
+    }
 
-        I2CDevice i2c_device_{};
-    };
+    template <BusDevice Bus, DMADevice DMA>
+    inline ADXL345<Bus, DMA>::ADXL345(Bus&& bus_device, Config const& config) noexcept :
+        scale_{config_to_scale(config)},
+        lsb_shift_{config_to_lsb_shift(config)},
+        bus_device_{std::forward<Bus>(bus_device)}
+    {
+        this->initialize(config);
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    inline ADXL345<Bus, DMA>::ADXL345(Bus&& bus_device, DMA&& dma_device, Config const& config) noexcept :
+        scale_{config_to_scale(config)},
+        lsb_shift_{config_to_lsb_shift(config)},
+        bus_device_{std::forward<Bus>(bus_device)},
+        dma_device_{std::forward<DMA>(dma_device)}
+    {
+        this->initialize(config);
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    inline ADXL345<Bus, DMA>::~ADXL345() noexcept
+    {
+        this->deinitialize();
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    inline std::optional<float> ADXL345<Bus, DMA>::get_acceleration_x_scaled() const noexcept
+    {
+        return this->get_acceleration_x_raw().transform(
+            [this](std::int16_t const raw) { return static_cast<float>(raw) * this->scale_; });
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    inline std::optional<float> ADXL345<Bus, DMA>::get_acceleration_y_scaled() const noexcept
+    {
+        return this->get_acceleration_y_raw().transform(
+            [this](std::int16_t const raw) { return static_cast<float>(raw) * this->scale_; });
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    inline std::optional<float> ADXL345<Bus, DMA>::get_acceleration_z_scaled() const noexcept
+    {
+        return this->get_acceleration_z_raw().transform(
+            [this](std::int16_t const raw) { return static_cast<float>(raw) * this->scale_; });
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    inline std::optional<Vec3D<float>> ADXL345<Bus, DMA>::get_acceleration_scaled() const noexcept
+    {
+        return this->get_acceleration_raw().transform(
+            [this](Vec3D<std::int16_t> const& raw) { return static_cast<Vec3D<float>>(raw) * this->scale_; });
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    inline std::optional<std::int32_t> ADXL345<Bus, DMA>::get_acceleration_x_milli_g() const noexcept
+    {
+        return this->get_acceleration_x_raw().transform(
+            [this](std::int16_t const raw) { return raw_to_milli_g(raw, this->lsb_shift_); });
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    inline std::optional<std::int32_t> ADXL345<Bus, DMA>::get_acceleration_y_milli_g() const noexcept
+    {
+        return this->get_acceleration_y_raw().transform(
+            [this](std::int16_t const raw) { return raw_to_milli_g(raw, this->lsb_shift_); });
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    inline std::optional<std::int32_t> ADXL345<Bus, DMA>::get_acceleration_z_milli_g() const noexcept
+    {
+        return this->get_acceleration_z_raw().transform(
+            [this](std::int16_t const raw) { return raw_to_milli_g(raw, this->lsb_shift_); });
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    inline std::optional<Vec3D<std::int32_t>> ADXL345<Bus, DMA>::get_acceleration_milli_g() const noexcept
+    {
+        return this->get_acceleration_raw().transform(
+            [this](Vec3D<std::int16_t> const& raw) { return raw_to_milli_g(raw, this->lsb_shift_); });
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    inline bool ADXL345<Bus, DMA>::start_fifo_streaming(FifoMode const fifo_mode,
+                                                        std::uint8_t const watermark,
+                                                        InterruptPin const interrupt_pin) const noexcept
+    {
+        if (!this->initialized_) {
+            return false;
+        }
+
+        auto const fifo_ctl =
+            FIFO_CTL{.samples = static_cast<std::uint8_t>(std::min(watermark, FIFO_MAX_WATERMARK) & 0x1FU),
+                     .trigger = 0U,
+                     .fifo_mode = static_cast<std::uint8_t>(std::to_underlying(fifo_mode) & 0b11U)};
+
+        return this->write(FIFO_CTL{.samples = 0U, .trigger = 0U, .fifo_mode = std::to_underlying(FifoMode::BYPASS)})
+                   .has_value() &&
+               this->modify<INT_MAP>([interrupt_pin](INT_MAP& int_map) {
+                       int_map.watermark = static_cast<std::uint8_t>(std::to_underlying(interrupt_pin) & 0b1U);
+                   })
+                   .has_value() &&
+               this->write(fifo_ctl).has_value() &&
+               this->modify<INT_ENABLE>([](INT_ENABLE& int_enable) { int_enable.watermark = 1U; }).has_value();
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    inline bool ADXL345<Bus, DMA>::stop_fifo_streaming() const noexcept
+    {
+        return this->initialized_ &&
+               this->modify<INT_ENABLE>([](INT_ENABLE& int_enable) { int_enable.watermark = 0U; }).has_value() &&
+               this->write(FIFO_CTL{.samples = 0U, .trigger = 0U, .fifo_mode = std::to_underlying(FifoMode::BYPASS)})
+                   .has_value();
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    inline std::optional<std::size_t> ADXL345<Bus, DMA>::get_fifo_entries() const noexcept
+    {
+        if (!this->initialized_) {
+            return std::nullopt;
+        }
+
+        auto const fifo_status = this->read<FIFO_STATUS>();
+        return fifo_status.has_value() ? std::optional<std::size_t>{fifo_status->entries}
+                                       : std::optional<std::size_t>{std::nullopt};
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    inline std::optional<std::size_t>
+    ADXL345<Bus, DMA>::drain_fifo_raw(std::span<Vec3D<std::int16_t>> const samples) const noexcept
+    {
+        return this->get_fifo_entries().transform([this, samples](std::size_t entries) {
+            auto drained = 0UZ;
+            while (entries > 0UZ && drained < samples.size()) {
+                auto const sample = this->pop_fifo_entry(entries);
+                if (!sample.has_value()) {
+                    break;
+                }
+                samples[drained++] = *sample;
+            }
+            return drained;
+        });
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    inline std::optional<std::size_t>
+    ADXL345<Bus, DMA>::drain_fifo_scaled(std::span<Vec3D<float>> const samples) const noexcept
+    {
+        std::array<Vec3D<std::int16_t>, FIFO_SIZE> raw{};
+        return this->drain_fifo_raw(std::span{raw}.first(std::min(samples.size(), FIFO_SIZE)))
+            .transform([this, samples, &raw](std::size_t const drained) {
+                ScaleKernel::raw_to_scaled(std::span{raw}.first(drained), samples, this->scale_);
+                return drained;
+            });
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    inline std::optional<std::size_t>
+    ADXL345<Bus, DMA>::drain_fifo_milli_g(std::span<Vec3D<std::int32_t>> const samples) const noexcept
+    {
+        std::array<Vec3D<std::int16_t>, FIFO_SIZE> raw{};
+        return this->drain_fifo_raw(std::span{raw}.first(std::min(samples.size(), FIFO_SIZE)))
+            .transform([this, samples, &raw](std::size_t const drained) {
+                ScaleKernel::raw_to_milli_g(std::span{raw}.first(drained), samples, this->lsb_shift_);
+                return drained;
+            });
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    template <std::size_t SIZE>
+    inline std::optional<std::size_t>
+    ADXL345<Bus, DMA>::drain_fifo_block(SampleBlock<std::int16_t, SIZE>& block) const noexcept
+    {
+        return this->get_fifo_entries().transform([this, &block](std::size_t entries) {
+            auto drained = 0UZ;
+            while (entries > 0UZ && !block.is_full()) {
+                auto const sample = this->pop_fifo_entry(entries);
+                if (!sample.has_value()) {
+                    break;
+                }
+                block.push(*sample);
+                ++drained;
+            }
+            return drained;
+        });
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    template <std::size_t SIZE>
+    inline bool ADXL345<Bus, DMA>::drain_fifo_block_async(SampleBlock<std::int16_t, SIZE>& block,
+                                                          DrainCallback const callback,
+                                                          void* const context) noexcept
+    {
+        if (!this->initialized_ || callback == nullptr || this->dma_device_.is_busy() ||
+            this->draining_.exchange(true, std::memory_order_acquire)) {
+            return false;
+        }
+
+        this->drain_block_ = &block;
+        this->drain_callback_ = callback;
+        this->drain_context_ = context;
+        this->drain_entries_ = 0UZ;
+        this->drained_ = 0UZ;
+        this->drain_retries_ = 0U;
+        this->drain_status_valid_ = false;
+
+        if (!this->template submit_drain_status_read<SIZE>()) {
+            this->drain_callback_ = nullptr;
+            this->draining_.store(false, std::memory_order_release);
+            return false;
+        }
+
+        return true;
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    inline bool ADXL345<Bus, DMA>::is_draining() const noexcept
+    {
+        return this->draining_.load(std::memory_order_acquire);
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    inline bool ADXL345<Bus, DMA>::set_data_rate(DataRate const data_rate) const noexcept
+    {
+        return this->initialized_ && this->modify<BW_RATE>([data_rate](BW_RATE& bw_rate) {
+                                         bw_rate.rate = static_cast<std::uint8_t>(std::to_underlying(data_rate) & 0xFU);
+                                     }).has_value();
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    inline std::optional<DataRate> ADXL345<Bus, DMA>::get_data_rate() const noexcept
+    {
+        if (!this->initialized_) {
+            return std::nullopt;
+        }
+
+        auto const bw_rate = this->read<BW_RATE>();
+        return bw_rate.has_value() ? std::optional<DataRate>{static_cast<DataRate>(bw_rate->rate)}
+                                   : std::optional<DataRate>{std::nullopt};
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    inline bool ADXL345<Bus, DMA>::set_activity_config(ActivityConfig const& activity_config) const noexcept
+    {
+        return this->initialized_ && this->write(activity_config.thresh_act,
+                                                 activity_config.thresh_inact,
+                                                 activity_config.time_inact,
+                                                 activity_config.act_inact_ctl)
+                                         .has_value();
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    inline bool ADXL345<Bus, DMA>::set_power_profile(PowerProfile const& power_profile) const noexcept
+    {
+        return this->initialized_ &&
+               this->write(power_profile.bw_rate,
+                           power_profile.power_ctl,
+                           power_profile.int_enable,
+                           power_profile.int_map)
+                   .has_value() &&
+               this->write(power_profile.fifo_ctl).has_value();
+    }
 
+    template <BusDevice Bus, DMADevice DMA>
+    inline std::optional<INT_SOURCE> ADXL345<Bus, DMA>::get_interrupt_source() const noexcept
+    {
+        if (!this->initialized_) {
+            return std::nullopt;
+        }
+
+        auto const int_source = this->read<INT_SOURCE>();
+        return int_source.has_value() ? std::optional<INT_SOURCE>{*int_source}
+                                      : std::optional<INT_SOURCE>{std::nullopt};
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    inline std::optional<ACT_TAP_STATUS> ADXL345<Bus, DMA>::get_activity_tap_status() const noexcept
+    {
+        if (!this->initialized_) {
+            return std::nullopt;
+        }
+
+        auto const act_tap_status = this->read<ACT_TAP_STATUS>();
+        return act_tap_status.has_value() ? std::optional<ACT_TAP_STATUS>{*act_tap_status}
+                                          : std::optional<ACT_TAP_STATUS>{std::nullopt};
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    inline bool ADXL345<Bus, DMA>::set_offsets(Vec3D<std::int8_t> const& offsets) const noexcept
+    {
+        return this->initialized_ && this->write(OFSX{.ofsx = std::bit_cast<std::uint8_t>(offsets.x)},
+                                                 OFSY{.ofsy = std::bit_cast<std::uint8_t>(offsets.y)},
+                                                 OFSZ{.ofsz = std::bit_cast<std::uint8_t>(offsets.z)})
+                                         .has_value();
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    inline std::optional<Vec3D<std::int8_t>> ADXL345<Bus, DMA>::get_offsets() const noexcept
+    {
+        if (!this->initialized_) {
+            return std::nullopt;
+        }
+
+        auto const ofsx = this->read<OFSX>();
+        auto const ofsy = this->read<OFSY>();
+        auto const ofsz = this->read<OFSZ>();
+        if (!ofsx.has_value() || !ofsy.has_value() || !ofsz.has_value()) {
+            return std::nullopt;
+        }
+
+        return Vec3D<std::int8_t>{std::bit_cast<std::int8_t>(ofsx->ofsx),
+                                  std::bit_cast<std::int8_t>(ofsy->ofsy),
+                                  std::bit_cast<std::int8_t>(ofsz->ofsz)};
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    inline std::optional<Vec3D<std::int8_t>>
+    ADXL345<Bus, DMA>::calibrate_offsets(std::size_t const sample_count,
+                                         Vec3D<std::int32_t> const& expected_milli_g,
+                                         Clock const clock,
+                                         void* const clock_context,
+                                         std::uint32_t const timeout_ms) const noexcept
+    {
+        if (!this->initialized_ || sample_count == 0UZ || clock == nullptr) {
+            return std::nullopt;
+        }
+
+        auto const previous_offsets = this->get_offsets();
+        auto const bw_rate = this->read<BW_RATE>();
+        auto const fifo_ctl = this->read<FIFO_CTL>();
+        if (!previous_offsets.has_value() || !bw_rate.has_value() || !fifo_ctl.has_value()) {
+            return std::nullopt;
+        }
+
+        auto const started =
+            this->set_offsets(Vec3D<std::int8_t>{}) && this->set_data_rate(CALIBRATION_DATA_RATE) &&
+            this->write(FIFO_CTL{.samples = 0U, .trigger = 0U, .fifo_mode = std::to_underlying(FifoMode::BYPASS)})
+                .has_value() &&
+            this->write(FIFO_CTL{.samples = 0U, .trigger = 0U, .fifo_mode = std::to_underlying(FifoMode::STREAM)})
+                .has_value();
+
+        std::array<std::int64_t, 3UZ> sums{};
+        std::array<std::int16_t, 3UZ> minimums{};
+        std::array<std::int16_t, 3UZ> maximums{};
+        minimums.fill(std::numeric_limits<std::int16_t>::max());
+        maximums.fill(std::numeric_limits<std::int16_t>::min());
+
+        auto collected = 0UZ;
+        std::array<Vec3D<std::int16_t>, FIFO_SIZE> raw{};
+        auto const start_ms = clock(clock_context);
+        while (started && collected < sample_count && clock(clock_context) - start_ms < timeout_ms) {
+            auto const drained =
+                this->drain_fifo_raw(std::span{raw}.first(std::min(FIFO_SIZE, sample_count - collected)));
+            if (!drained.has_value()) {
+                break;
+            }
+
+            for (auto const& sample : std::span{raw}.first(*drained)) {
+                auto const axes = std::array{sample.x, sample.y, sample.z};
+                for (auto axis = 0UZ; axis < axes.size(); ++axis) {
+                    sums[axis] += axes[axis];
+                    minimums[axis] = std::min(minimums[axis], axes[axis]);
+                    maximums[axis] = std::max(maximums[axis], axes[axis]);
+                }
+            }
+            collected += *drained;
+        }
+
+        auto const restored = this->write(*fifo_ctl).has_value() && this->write(*bw_rate).has_value();
+
+        auto const expected = std::array{expected_milli_g.x, expected_milli_g.y, expected_milli_g.z};
+        std::array<float, 3UZ> errors_g{};
+        auto at_rest = collected >= sample_count;
+        for (auto axis = 0UZ; at_rest && axis < expected.size(); ++axis) {
+            auto const average_g = static_cast<float>(sums[axis]) / static_cast<float>(collected) /
+                                   static_cast<float>(std::int32_t{1} << this->lsb_shift_);
+            errors_g[axis] = average_g - static_cast<float>(expected[axis]) / static_cast<float>(MILLI_G_PER_G);
+
+            auto const spread_milli_g =
+                raw_to_milli_g(maximums[axis], this->lsb_shift_) - raw_to_milli_g(minimums[axis], this->lsb_shift_);
+            at_rest = spread_milli_g <= CALIBRATION_MAX_SPREAD_MILLI_G &&
+                      std::abs(errors_g[axis]) * static_cast<float>(MILLI_G_PER_G) <=
+                          static_cast<float>(CALIBRATION_MAX_ERROR_MILLI_G);
+        }
+
+        if (!restored || !at_rest) {
+            this->set_offsets(*previous_offsets);
+            return std::nullopt;
+        }
+
+        auto const to_offset = [](float const error_g) {
+            return static_cast<std::int8_t>(
+                std::clamp(-std::lround(error_g * static_cast<float>(OFFSET_LSB_PER_G)), -128L, 127L));
+        };
+
+        auto const offsets =
+            Vec3D<std::int8_t>{to_offset(errors_g[0]), to_offset(errors_g[1]), to_offset(errors_g[2])};
+
+        return this->set_offsets(offsets) ? std::optional<Vec3D<std::int8_t>>{offsets}
+                                          : std::optional<Vec3D<std::int8_t>>{std::nullopt};
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    inline bool ADXL345<Bus, DMA>::resync_registers() noexcept
+    {
+        if (!this->initialized_) {
+            return false;
+        }
+
+        auto const registers = this->read_shadowed_registers();
+        if (registers.has_value()) {
+            this->shadow_ = *registers;
+
+            auto const data_format =
+                std::bit_cast<DATA_FORMAT>((*registers)[REG_ADDRESS<DATA_FORMAT> - SHADOW_FIRST_REG_ADDRESS]);
+            this->scale_ = data_format_to_scale(data_format);
+            this->lsb_shift_ = data_format_to_lsb_shift(data_format);
+        }
+        this->shadow_valid_ = registers.has_value();
+        return this->shadow_valid_;
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    inline bool ADXL345<Bus, DMA>::verify_registers() const noexcept
+    {
+        return this->initialized_ && this->shadow_valid_ && this->read_shadowed_registers() == this->shadow_;
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    inline void ADXL345<Bus, DMA>::set_max_retries(std::uint8_t const max_retries) noexcept
+    {
+        this->max_retries_ = max_retries;
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    inline TransportStatistics const& ADXL345<Bus, DMA>::get_transport_statistics() const noexcept
+    {
+        return this->transport_statistics_;
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    inline void ADXL345<Bus, DMA>::clear_transport_statistics() noexcept
+    {
+        this->transport_statistics_ = {};
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    inline Expected<std::array<std::uint8_t, ADXL345<Bus, DMA>::SHADOW_SIZE>>
+    ADXL345<Bus, DMA>::read_shadowed_registers() const noexcept
+    {
+        std::array<std::uint8_t, REG_ADDRESS<INT_MAP> - SHADOW_FIRST_REG_ADDRESS + 1UZ> bytes{};
+        if (auto const result = this->read_bytes(SHADOW_FIRST_REG_ADDRESS, bytes); !result.has_value()) {
+            return ::BusError::Unexpected{result.error()};
+        }
+
+        auto const data_format = this->read_byte(REG_ADDRESS<DATA_FORMAT>);
+        if (!data_format.has_value()) {
+            return ::BusError::Unexpected{data_format.error()};
+        }
+
+        auto const fifo_ctl = this->read_byte(REG_ADDRESS<FIFO_CTL>);
+        if (!fifo_ctl.has_value()) {
+            return ::BusError::Unexpected{fifo_ctl.error()};
+        }
+
+        std::array<std::uint8_t, SHADOW_SIZE> registers{};
+        for (auto index = 0UZ; index < bytes.size(); ++index) {
+            if (is_cached_register(static_cast<std::uint8_t>(SHADOW_FIRST_REG_ADDRESS + index))) {
+                registers[index] = bytes[index];
+            }
+        }
+        registers[REG_ADDRESS<DATA_FORMAT> - SHADOW_FIRST_REG_ADDRESS] = *data_format;
+        registers[REG_ADDRESS<FIFO_CTL> - SHADOW_FIRST_REG_ADDRESS] = *fifo_ctl;
+
+        return registers;
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    inline Vec3D<std::int16_t> ADXL345<Bus, DMA>::data_to_raw(DATA const& data) noexcept
+    {
+        return Vec3D<std::int16_t>{std::bit_cast<std::int16_t>(data.data_x),
+                                   std::bit_cast<std::int16_t>(data.data_y),
+                                   std::bit_cast<std::int16_t>(data.data_z)};
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    inline std::optional<Vec3D<std::int16_t>> ADXL345<Bus, DMA>::pop_fifo_entry(std::size_t& entries) const noexcept
+    {
+        if constexpr (IS_FAST_BURST<Bus>) {
+            auto const data = this->read<DATA>();
+            if (!data.has_value()) {
+                return std::nullopt;
+            }
+            if (--entries == 0UZ) {
+                entries = this->get_fifo_entries().value_or(0UZ);
+            }
+            return data_to_raw(*data);
+        } else {
+            auto const fifo_data = this->read<FIFO_DATA>();
+            if (!fifo_data.has_value()) {
+                return std::nullopt;
+            }
+            entries = fifo_data->fifo_status.entries;
+            return data_to_raw(fifo_data->data);
+        }
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
     template <std::size_t SIZE>
-    inline std::array<std::uint8_t, SIZE> ADXL345::read_bytes(std::uint8_t const reg_address) const noexcept
+    inline void ADXL345<Bus, DMA>::drain_status_callback(void* const context,
+                                                         std::span<std::uint8_t const> const bytes) noexcept
     {
-        return this->i2c_device_.read_bytes<SIZE>(reg_address);
+        auto* const adxl345 = static_cast<ADXL345*>(context);
+        if (bytes.size() != sizeof(FIFO_STATUS)) {
+            if (!adxl345->retry_drain_read()) {
+                adxl345->finish_drain(true);
+            }
+            return;
+        }
+
+        adxl345->drain_retries_ = 0U;
+        adxl345->drain_status_valid_ = true;
+        adxl345->drain_entries_ = std::bit_cast<FIFO_STATUS>(bytes[0]).entries;
+        adxl345->template continue_drain<SIZE>();
     }
 
+    template <BusDevice Bus, DMADevice DMA>
     template <std::size_t SIZE>
-    inline void ADXL345::write_bytes(std::uint8_t const reg_address,
-                                     std::array<std::uint8_t, SIZE> const& bytes) const noexcept
+    inline void ADXL345<Bus, DMA>::drain_data_callback(void* const context,
+                                                       std::span<std::uint8_t const> const bytes) noexcept
     {
-        this->i2c_device_.write_byte(reg_address, bytes);
+        auto* const adxl345 = static_cast<ADXL345*>(context);
+        if (bytes.size() != DRAIN_ENTRY_SIZE) {
+            if (!adxl345->retry_drain_read()) {
+                adxl345->finish_drain(true);
+            }
+            return;
+        }
+
+        auto& block = *static_cast<SampleBlock<std::int16_t, SIZE>*>(adxl345->drain_block_);
+        auto const fifo_data = std::bit_cast<FIFO_DATA>(adxl345->drain_buffer_);
+        block.push(data_to_raw(fifo_data.data));
+
+        adxl345->drain_retries_ = 0U;
+        ++adxl345->drained_;
+        if constexpr (IS_FAST_BURST<DMA>) {
+            if (--adxl345->drain_entries_ == 0UZ && !block.is_full()) {
+                if (!adxl345->template submit_drain_status_read<SIZE>()) {
+                    adxl345->finish_drain(true);
+                }
+                return;
+            }
+        } else {
+            adxl345->drain_entries_ = fifo_data.fifo_status.entries;
+        }
+        adxl345->template continue_drain<SIZE>();
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    template <std::size_t SIZE>
+    inline void ADXL345<Bus, DMA>::continue_drain() noexcept
+    {
+        auto const& block = *static_cast<SampleBlock<std::int16_t, SIZE> const*>(this->drain_block_);
+        if (this->drain_entries_ == 0UZ || block.is_full()) {
+            this->finish_drain(true);
+            return;
+        }
+
+        if (!this->submit_drain_read(REG_ADDRESS<FIFO_DATA>, DRAIN_ENTRY_SIZE, &ADXL345::drain_data_callback<SIZE>)) {
+            this->finish_drain(true);
+        }
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    template <std::size_t SIZE>
+    inline bool ADXL345<Bus, DMA>::submit_drain_status_read() noexcept
+    {
+        return this->submit_drain_read(REG_ADDRESS<FIFO_STATUS>,
+                                       sizeof(FIFO_STATUS),
+                                       &ADXL345::drain_status_callback<SIZE>);
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    inline bool ADXL345<Bus, DMA>::submit_drain_read(std::uint8_t const reg_address,
+                                                     std::size_t const size,
+                                                     TransferCallback const callback) noexcept
+    {
+        this->drain_reg_address_ = reg_address;
+        this->drain_size_ = size;
+        this->drain_transfer_callback_ = callback;
+
+        ++this->transport_statistics_.transactions;
+        if (!this->dma_device_
+                 .read_bytes_dma(reg_address, std::span{this->drain_buffer_}.first(size), callback, this)
+                 .has_value()) {
+            ++this->transport_statistics_.failures;
+            return false;
+        }
+
+        return true;
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    inline bool ADXL345<Bus, DMA>::retry_drain_read() noexcept
+    {
+        if (this->drain_retries_ >= this->max_retries_) {
+            ++this->transport_statistics_.failures;
+            return false;
+        }
+
+        ++this->drain_retries_;
+        ++this->transport_statistics_.retries;
+        return this->submit_drain_read(this->drain_reg_address_, this->drain_size_, this->drain_transfer_callback_);
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    inline void ADXL345<Bus, DMA>::finish_drain(bool const success) noexcept
+    {
+        auto const callback = std::exchange(this->drain_callback_, nullptr);
+        auto* const context = this->drain_context_;
+        auto const drained = success && this->drain_status_valid_ ? std::optional<std::size_t>{this->drained_}
+                                                                  : std::optional<std::size_t>{std::nullopt};
+
+        this->draining_.store(false, std::memory_order_release);
+
+        if (callback != nullptr) {
+            callback(context, drained);
+        }
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    inline Expected<std::uint8_t> ADXL345<Bus, DMA>::read_byte(std::uint8_t const reg_address) const noexcept
+    {
+        return this->transfer_with_retry([this, reg_address] { return this->bus_device_.read_byte(reg_address); });
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    inline Expected<void> ADXL345<Bus, DMA>::read_bytes(std::uint8_t const reg_address,
+                                                        std::span<std::uint8_t> const bytes) const noexcept
+    {
+        return this->transfer_with_retry(
+            [this, reg_address, bytes] { return this->bus_device_.read_bytes(reg_address, bytes); });
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    inline Expected<void> ADXL345<Bus, DMA>::write_byte(std::uint8_t const reg_address,
+                                                        std::uint8_t const byte) const noexcept
+    {
+        return this->transfer_with_retry(
+            [this, reg_address, byte] { return this->bus_device_.write_byte(reg_address, byte); });
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    inline Expected<void> ADXL345<Bus, DMA>::write_bytes(std::uint8_t const reg_address,
+                                                         std::span<std::uint8_t const> const bytes) const noexcept
+    {
+        return this->transfer_with_retry(
+            [this, reg_address, bytes] { return this->bus_device_.write_bytes(reg_address, bytes); });
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    inline void ADXL345<Bus, DMA>::initialize(Config const& config) noexcept
+    {
+        if (this->is_valid_device_id()) {
+            this->initialized_ =
+                this->write(config.thresh_tap,
+                            config.ofsx,
+                            config.ofsy,
+                            config.ofsz,
+                            config.dur,
+                            config.latent,
+                            config.window,
+                            config.thresh_act,
+                            config.thresh_inact,
+                            config.time_inact,
+                            config.act_inact_ctl,
+                            config.thresh_ff,
+                            config.time_ff,
+                            config.tap_axes)
+                    .has_value() &&
+                this->write(config.data_format).has_value() && this->write(config.fifo_ctl).has_value() &&
+                this->write(config.bw_rate, config.power_ctl, config.int_enable, config.int_map).has_value();
+            this->shadow_valid_ = this->initialized_;
+        }
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    inline void ADXL345<Bus, DMA>::deinitialize() noexcept
+    {
+        if (this->is_valid_device_id()) {
+            this->shadow_valid_ = false;
+            this->initialized_ = false;
+        }
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    inline bool ADXL345<Bus, DMA>::is_valid_device_id() const noexcept
+    {
+        return this->get_device_id() == CHIP_ID;
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    inline Expected<std::uint8_t> ADXL345<Bus, DMA>::get_device_id() const noexcept
+    {
+        auto const devid = this->read<DEVID>();
+        return devid.has_value() ? Expected<std::uint8_t>{std::bit_cast<std::uint8_t>(*devid)}
+                                 : Expected<std::uint8_t>{::BusError::Unexpected{devid.error()}};
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    inline std::optional<std::int16_t> ADXL345<Bus, DMA>::get_acceleration_x_raw() const noexcept
+    {
+        if (!this->initialized_) {
+            return std::nullopt;
+        }
+
+        auto const data_x = this->read<DATA_X>();
+        return data_x.has_value() ? std::optional<std::int16_t>{std::bit_cast<std::int16_t>(*data_x)}
+                                  : std::optional<std::int16_t>{std::nullopt};
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    inline std::optional<std::int16_t> ADXL345<Bus, DMA>::get_acceleration_y_raw() const noexcept
+    {
+        if (!this->initialized_) {
+            return std::nullopt;
+        }
+
+        auto const data_y = this->read<DATA_Y>();
+        return data_y.has_value() ? std::optional<std::int16_t>{std::bit_cast<std::int16_t>(*data_y)}
+                                  : std::optional<std::int16_t>{std::nullopt};
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    inline std::optional<std::int16_t> ADXL345<Bus, DMA>::get_acceleration_z_raw() const noexcept
+    {
+        if (!this->initialized_) {
+            return std::nullopt;
+        }
+
+        auto const data_z = this->read<DATA_Z>();
+        return data_z.has_value() ? std::optional<std::int16_t>{std::bit_cast<std::int16_t>(*data_z)}
+                                  : std::optional<std::int16_t>{std::nullopt};
+    }
+
+    template <BusDevice Bus, DMADevice DMA>
+    inline std::optional<Vec3D<std::int16_t>> ADXL345<Bus, DMA>::get_acceleration_raw() const noexcept
+    {
+        if (!this->initialized_) {
+            return std::nullopt;
+        }
+
+        auto const data = this->read<DATA>();
+        return data.has_value() ? std::optional<Vec3D<std::int16_t>>{data_to_raw(*data)}
+                                : std::optional<Vec3D<std::int16_t>>{std::nullopt};
     }
 
 }; // namespace ADXL345
 
-#endif // ADXL345_HPP
\ No newline at end of file
+#endif // ADXL345_HPP
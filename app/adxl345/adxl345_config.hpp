@@ -2,14 +2,29 @@
 #define ADXL345_CONFIG_HPP
 
 #include "adxl345_registers.hpp"
+#include "bus_error.hpp"
+#include "sample_block.hpp"
+#include "scale_kernel.hpp"
 #include "vector3d.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <cstdint>
+#include <utility>
 
 namespace ADXL345 {
 
     template <typename T>
     using Vec3D = Utility::Vector3D<T>;
 
+    template <typename T, std::size_t SIZE>
+    using SampleBlock = ::SampleBlock::SampleBlock<T, SIZE>;
+
+    using BusError = ::BusError::BusError;
+
+    template <typename T>
+    using Expected = ::BusError::Expected<T>;
+
     enum struct RA : std::uint8_t {
         DEVID = 0x00,
         THRESH_TAP = 0x1D,
@@ -43,6 +58,11 @@ namespace ADXL345 {
         FIFO_STATUS = 0x39,
     };
 
+    enum struct DevAddress : std::uint16_t {
+        ALT_LOW = 0x53,
+        ALT_HIGH = 0x1D,
+    };
+
     enum struct DataRate : std::uint8_t {
         RATE_3200HZ = 0b1111,
         RATE_1600HZ = 0b1110,
@@ -76,27 +96,135 @@ namespace ADXL345 {
         RATE_1HZ = 0b11,
     };
 
-    std::uint8_t constexpr CHIP_ID = 0U;
+    enum struct FifoMode : std::uint8_t {
+        BYPASS = 0b00,
+        FIFO = 0b01,
+        STREAM = 0b10,
+        TRIGGER = 0b11,
+    };
+
+    enum struct InterruptPin : std::uint8_t {
+        INT1 = 0b0,
+        INT2 = 0b1,
+    };
+
+    std::uint8_t constexpr CHIP_ID = 0xE5U;
+
+    std::size_t constexpr FIFO_SIZE = 32UZ;
+    std::uint8_t constexpr FIFO_MAX_WATERMARK = 31U;
+
+    std::uint8_t constexpr DEFAULT_MAX_RETRIES = 2U;
+
+    float constexpr MAX_DATA_RATE_HZ = 3200.0F;
+
+    constexpr float data_rate_to_frequency(DataRate const data_rate) noexcept
+    {
+        return MAX_DATA_RATE_HZ /
+               static_cast<float>(1U << (std::to_underlying(DataRate::RATE_3200HZ) - std::to_underlying(data_rate)));
+    }
+
+    static_assert(data_rate_to_frequency(DataRate::RATE_100HZ) == 100.0F);
+
+    constexpr bool is_low_power_data_rate(DataRate const data_rate) noexcept
+    {
+        return data_rate >= DataRate::RATE_12HZ5 && data_rate <= DataRate::RATE_400HZ;
+    }
+
+    std::int32_t constexpr OFFSET_LSB_PER_G = 64;
+
+    using Clock = std::uint32_t (*)(void* const context) noexcept;
+
+    DataRate constexpr CALIBRATION_DATA_RATE = DataRate::RATE_800HZ;
+    std::uint32_t constexpr CALIBRATION_TIMEOUT_MS = 1'000U;
+    std::int32_t constexpr CALIBRATION_MAX_SPREAD_MILLI_G = 100;
+    std::int32_t constexpr CALIBRATION_MAX_ERROR_MILLI_G = 250;
+
+    struct TransportStatistics {
+        std::uint32_t transactions{};
+        std::uint32_t retries{};
+        std::uint32_t failures{};
+    };
+
+    float constexpr STANDARD_GRAVITY = 9.80665F;
+
+    std::int32_t constexpr MILLI_G_PER_G = ScaleKernel::MILLI_G_PER_G;
+
+    std::size_t constexpr SCALE_TABLE_SIZE = 16UZ;
 
-    inline float range_to_scale(Range const range) noexcept
+    constexpr std::size_t data_format_to_scale_index(DATA_FORMAT const data_format) noexcept
     {
-        switch (range) {
-            case Range::FS_2G:
-                return 0.01916F;
-            case Range::FS_4G:
-                return 0.03823F;
-            case Range::FS_8G:
-                return 0.07664F;
-            case Range::FS_16G:
-                return 0.15328F;
+        return static_cast<std::size_t>(data_format.range) | (data_format.justify == 1U ? 0b0100UZ : 0UZ) |
+               (data_format.full_res == 1U ? 0b1000UZ : 0UZ);
+    }
+
+    constexpr std::array<std::uint8_t, SCALE_TABLE_SIZE> make_lsb_shift_table() noexcept
+    {
+        std::array<std::uint8_t, SCALE_TABLE_SIZE> lsb_shift_table{};
+        for (auto index = 0UZ; index < lsb_shift_table.size(); ++index) {
+            auto const range = static_cast<std::uint8_t>(index & 0b0011UZ);
+            auto const justify = (index & 0b0100UZ) != 0UZ;
+            auto const full_res = (index & 0b1000UZ) != 0UZ;
+            lsb_shift_table[index] = static_cast<std::uint8_t>(justify ? 14U - range : full_res ? 8U : 8U - range);
         }
+        return lsb_shift_table;
+    }
+
+    std::array<std::uint8_t, SCALE_TABLE_SIZE> constexpr LSB_SHIFT_TABLE = make_lsb_shift_table();
+
+    constexpr std::array<float, SCALE_TABLE_SIZE> make_scale_table() noexcept
+    {
+        std::array<float, SCALE_TABLE_SIZE> scale_table{};
+        std::ranges::transform(LSB_SHIFT_TABLE, scale_table.begin(), [](std::uint8_t const lsb_shift) {
+            return STANDARD_GRAVITY / static_cast<float>(1UL << lsb_shift);
+        });
+        return scale_table;
+    }
+
+    std::array<float, SCALE_TABLE_SIZE> constexpr SCALE_TABLE = make_scale_table();
+
+    constexpr float range_to_scale(Range const range) noexcept
+    {
+        return SCALE_TABLE[std::to_underlying(range)];
+    }
+
+    constexpr float data_format_to_scale(DATA_FORMAT const data_format) noexcept
+    {
+        return SCALE_TABLE[data_format_to_scale_index(data_format)];
     }
 
-    inline float config_to_scale(Config const& config) noexcept
+    constexpr std::uint8_t data_format_to_lsb_shift(DATA_FORMAT const data_format) noexcept
     {
-        return range_to_scale(static_cast<Range>(config.data_format.range));
+        return LSB_SHIFT_TABLE[data_format_to_scale_index(data_format)];
     }
 
+    constexpr float config_to_scale(Config const& config) noexcept
+    {
+        return data_format_to_scale(config.data_format);
+    }
+
+    constexpr std::uint8_t config_to_lsb_shift(Config const& config) noexcept
+    {
+        return data_format_to_lsb_shift(config.data_format);
+    }
+
+    constexpr std::int32_t raw_to_milli_g(std::int16_t const raw, std::uint8_t const lsb_shift) noexcept
+    {
+        return (static_cast<std::int32_t>(raw) * MILLI_G_PER_G + (std::int32_t{1} << (lsb_shift - 1U))) >> lsb_shift;
+    }
+
+    constexpr Vec3D<std::int32_t> raw_to_milli_g(Vec3D<std::int16_t> const& raw, std::uint8_t const lsb_shift) noexcept
+    {
+        return Vec3D<std::int32_t>{raw_to_milli_g(raw.x, lsb_shift),
+                                   raw_to_milli_g(raw.y, lsb_shift),
+                                   raw_to_milli_g(raw.z, lsb_shift)};
+    }
+
+    static_assert(LSB_SHIFT_TABLE[0b1011UZ] == 8U);
+    static_assert(LSB_SHIFT_TABLE[0b0011UZ] == 5U);
+    static_assert(LSB_SHIFT_TABLE[0b1100UZ] == 14U);
+    static_assert(raw_to_milli_g(std::int16_t{256}, 8U) == MILLI_G_PER_G);
+    static_assert(raw_to_milli_g(std::int16_t{-4096}, 8U) == -16 * MILLI_G_PER_G);
+
 }; // namespace ADXL345
 
 #endif // ADXL345_CONFIG_HPP
\ No newline at end of file
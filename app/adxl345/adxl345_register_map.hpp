@@ -0,0 +1,165 @@
+#ifndef ADXL345_REGISTER_MAP_HPP
+#define ADXL345_REGISTER_MAP_HPP
+
+#include "adxl345_config.hpp"
+#include "adxl345_registers.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+
+namespace ADXL345 {
+
+    enum struct Access : std::uint8_t {
+        RESERVED,
+        READ_ONLY,
+        READ_WRITE,
+        VOLATILE,
+    };
+
+    template <RA REG_ADDRESS, Access REG_ACCESS>
+    struct Descriptor {
+        static RA constexpr ADDRESS = REG_ADDRESS;
+        static Access constexpr ACCESS = REG_ACCESS;
+    };
+
+    template <typename Register>
+    struct RegisterDescriptor;
+
+    template <>
+    struct RegisterDescriptor<DEVID> : Descriptor<RA::DEVID, Access::READ_ONLY> {};
+    template <>
+    struct RegisterDescriptor<THRESH_TAP> : Descriptor<RA::THRESH_TAP, Access::READ_WRITE> {};
+    template <>
+    struct RegisterDescriptor<OFSX> : Descriptor<RA::OFSX, Access::READ_WRITE> {};
+    template <>
+    struct RegisterDescriptor<OFSY> : Descriptor<RA::OFSY, Access::READ_WRITE> {};
+    template <>
+    struct RegisterDescriptor<OFSZ> : Descriptor<RA::OFSZ, Access::READ_WRITE> {};
+    template <>
+    struct RegisterDescriptor<DUR> : Descriptor<RA::DUR, Access::READ_WRITE> {};
+    template <>
+    struct RegisterDescriptor<LATENT> : Descriptor<RA::LATENT, Access::READ_WRITE> {};
+    template <>
+    struct RegisterDescriptor<WINDOW> : Descriptor<RA::WINDOW, Access::READ_WRITE> {};
+    template <>
+    struct RegisterDescriptor<THRESH_ACT> : Descriptor<RA::THRESH_ACT, Access::READ_WRITE> {};
+    template <>
+    struct RegisterDescriptor<THRESH_INACT> : Descriptor<RA::THRESH_INACT, Access::READ_WRITE> {};
+    template <>
+    struct RegisterDescriptor<TIME_INACT> : Descriptor<RA::TIME_INACT, Access::READ_WRITE> {};
+    template <>
+    struct RegisterDescriptor<ACT_INACT_CTL> : Descriptor<RA::ACT_INACT_CTL, Access::READ_WRITE> {};
+    template <>
+    struct RegisterDescriptor<THRESH_FF> : Descriptor<RA::THRESH_FF, Access::READ_WRITE> {};
+    template <>
+    struct RegisterDescriptor<TIME_FF> : Descriptor<RA::TIME_FF, Access::READ_WRITE> {};
+    template <>
+    struct RegisterDescriptor<TAP_AXES> : Descriptor<RA::TAP_AXES, Access::READ_WRITE> {};
+    template <>
+    struct RegisterDescriptor<ACT_TAP_STATUS> : Descriptor<RA::ACT_TAP_STATUS, Access::VOLATILE> {};
+    template <>
+    struct RegisterDescriptor<BW_RATE> : Descriptor<RA::BW_RATE, Access::READ_WRITE> {};
+    template <>
+    struct RegisterDescriptor<POWER_CTL> : Descriptor<RA::POWER_CTL, Access::READ_WRITE> {};
+    template <>
+    struct RegisterDescriptor<INT_ENABLE> : Descriptor<RA::INT_ENABLE, Access::READ_WRITE> {};
+    template <>
+    struct RegisterDescriptor<INT_MAP> : Descriptor<RA::INT_MAP, Access::READ_WRITE> {};
+    template <>
+    struct RegisterDescriptor<INT_SOURCE> : Descriptor<RA::INT_SOURCE, Access::VOLATILE> {};
+    template <>
+    struct RegisterDescriptor<DATA_FORMAT> : Descriptor<RA::DATA_FORMAT, Access::READ_WRITE> {};
+    template <>
+    struct RegisterDescriptor<DATA_X> : Descriptor<RA::DATA_X0, Access::VOLATILE> {};
+    template <>
+    struct RegisterDescriptor<DATA_Y> : Descriptor<RA::DATA_Y0, Access::VOLATILE> {};
+    template <>
+    struct RegisterDescriptor<DATA_Z> : Descriptor<RA::DATA_Z0, Access::VOLATILE> {};
+    template <>
+    struct RegisterDescriptor<DATA> : Descriptor<RA::DATA_X0, Access::VOLATILE> {};
+    template <>
+    struct RegisterDescriptor<FIFO_CTL> : Descriptor<RA::FIFO_CTL, Access::READ_WRITE> {};
+    template <>
+    struct RegisterDescriptor<FIFO_STATUS> : Descriptor<RA::FIFO_STATUS, Access::VOLATILE> {};
+    template <>
+    struct RegisterDescriptor<FIFO_DATA> : Descriptor<RA::DATA_X0, Access::VOLATILE> {};
+
+    template <typename Register>
+    concept Readable = RegisterDescriptor<Register>::ACCESS != Access::RESERVED;
+
+    template <typename Register>
+    concept Writable = RegisterDescriptor<Register>::ACCESS == Access::READ_WRITE;
+
+    template <typename Register>
+    std::uint8_t constexpr REG_ADDRESS = std::to_underlying(RegisterDescriptor<Register>::ADDRESS);
+
+    template <typename Register, typename... Registers>
+    constexpr bool is_contiguous() noexcept
+    {
+        std::array<std::size_t, 1UZ + sizeof...(Registers)> constexpr addresses{REG_ADDRESS<Register>,
+                                                                                REG_ADDRESS<Registers>...};
+        std::array<std::size_t, 1UZ + sizeof...(Registers)> constexpr sizes{sizeof(Register), sizeof(Registers)...};
+
+        for (auto index = 1UZ; index < addresses.size(); ++index) {
+            if (addresses[index] != addresses[index - 1UZ] + sizes[index - 1UZ]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    std::size_t constexpr REGISTER_MAP_SIZE = std::to_underlying(RA::FIFO_STATUS) + 1UZ;
+
+    template <typename... Registers>
+    constexpr std::array<Access, REGISTER_MAP_SIZE> make_register_map() noexcept
+    {
+        std::array<Access, REGISTER_MAP_SIZE> register_map{};
+        (std::fill_n(std::next(register_map.begin(), REG_ADDRESS<Registers>),
+                     sizeof(Registers),
+                     RegisterDescriptor<Registers>::ACCESS),
+         ...);
+        return register_map;
+    }
+
+    std::array<Access, REGISTER_MAP_SIZE> constexpr REGISTER_MAP = make_register_map<DEVID,
+                                                                                     THRESH_TAP,
+                                                                                     OFSX,
+                                                                                     OFSY,
+                                                                                     OFSZ,
+                                                                                     DUR,
+                                                                                     LATENT,
+                                                                                     WINDOW,
+                                                                                     THRESH_ACT,
+                                                                                     THRESH_INACT,
+                                                                                     TIME_INACT,
+                                                                                     ACT_INACT_CTL,
+                                                                                     THRESH_FF,
+                                                                                     TIME_FF,
+                                                                                     TAP_AXES,
+                                                                                     ACT_TAP_STATUS,
+                                                                                     BW_RATE,
+                                                                                     POWER_CTL,
+                                                                                     INT_ENABLE,
+                                                                                     INT_MAP,
+                                                                                     INT_SOURCE,
+                                                                                     DATA_FORMAT,
+                                                                                     DATA,
+                                                                                     FIFO_CTL,
+                                                                                     FIFO_STATUS>();
+
+    constexpr Access get_register_access(std::uint8_t const reg_address) noexcept
+    {
+        return reg_address < REGISTER_MAP.size() ? REGISTER_MAP[reg_address] : Access::RESERVED;
+    }
+
+    constexpr bool is_cached_register(std::uint8_t const reg_address) noexcept
+    {
+        return get_register_access(reg_address) == Access::READ_WRITE;
+    }
+
+}; // namespace ADXL345
+
+#endif // ADXL345_REGISTER_MAP_HPP
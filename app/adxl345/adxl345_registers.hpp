@@ -52,14 +52,14 @@ namespace ADXL345 {
     } PACKED;
 
     struct ACT_INACT_CTL {
-        std::uint8_t act_ac_dc : 1;
-        std::uint8_t act_x_en : 1;
-        std::uint8_t act_y_en : 1;
-        std::uint8_t act_z_en : 1;
-        std::uint8_t inact_ac_dc : 1;
-        std::uint8_t inact_x_en : 1;
-        std::uint8_t inact_y_en : 1;
         std::uint8_t inact_z_en : 1;
+        std::uint8_t inact_y_en : 1;
+        std::uint8_t inact_x_en : 1;
+        std::uint8_t inact_ac_dc : 1;
+        std::uint8_t act_z_en : 1;
+        std::uint8_t act_y_en : 1;
+        std::uint8_t act_x_en : 1;
+        std::uint8_t act_ac_dc : 1;
     } PACKED;
 
     struct THRESH_FF {
@@ -71,80 +71,80 @@ namespace ADXL345 {
     } PACKED;
 
     struct TAP_AXES {
-        std::uint8_t : 4;
-        std::uint8_t suppress : 1;
-        std::uint8_t tap_x_en : 1;
-        std::uint8_t tap_y_en : 1;
         std::uint8_t tap_z_en : 1;
+        std::uint8_t tap_y_en : 1;
+        std::uint8_t tap_x_en : 1;
+        std::uint8_t suppress : 1;
+        std::uint8_t : 4;
     } PACKED;
 
     struct ACT_TAP_STATUS {
-        std::uint8_t : 1;
-        std::uint8_t act_x_src : 1;
-        std::uint8_t act_y_src : 1;
-        std::uint8_t act_z_src : 1;
-        std::uint8_t asleep : 1;
-        std::uint8_t tap_x_src : 1;
-        std::uint8_t tap_y_src : 1;
         std::uint8_t tap_z_src : 1;
+        std::uint8_t tap_y_src : 1;
+        std::uint8_t tap_x_src : 1;
+        std::uint8_t asleep : 1;
+        std::uint8_t act_z_src : 1;
+        std::uint8_t act_y_src : 1;
+        std::uint8_t act_x_src : 1;
+        std::uint8_t : 1;
     } PACKED;
 
     struct BW_RATE {
-        std::uint8_t : 3;
-        std::uint8_t low_power : 1;
         std::uint8_t rate : 4;
+        std::uint8_t low_power : 1;
+        std::uint8_t : 3;
     } PACKED;
 
     struct POWER_CTL {
-        std::uint8_t : 2;
-        std::uint8_t link : 1;
-        std::uint8_t auto_sleep : 1;
-        std::uint8_t measure : 1;
-        std::uint8_t sleep : 1;
         std::uint8_t wakeup : 2;
+        std::uint8_t sleep : 1;
+        std::uint8_t measure : 1;
+        std::uint8_t auto_sleep : 1;
+        std::uint8_t link : 1;
+        std::uint8_t : 2;
     } PACKED;
 
     struct INT_ENABLE {
-        std ::uint8_t data_ready : 1;
-        std::uint8_t single_tap : 1;
-        std::uint8_t double_tap : 1;
-        std::uint8_t activity : 1;
-        std::uint8_t inactivity : 1;
-        std::uint8_t free_fall : 1;
-        std::uint8_t watermark : 1;
         std::uint8_t overrun : 1;
+        std::uint8_t watermark : 1;
+        std::uint8_t free_fall : 1;
+        std::uint8_t inactivity : 1;
+        std::uint8_t activity : 1;
+        std::uint8_t double_tap : 1;
+        std::uint8_t single_tap : 1;
+        std::uint8_t data_ready : 1;
     } PACKED;
 
     struct INT_MAP {
-        std::uint8_t data_ready : 1;
-        std::uint8_t single_tap : 1;
-        std::uint8_t double_tap : 1;
-        std::uint8_t activity : 1;
-        std::uint8_t inactivity : 1;
-        std::uint8_t free_fall : 1;
-        std::uint8_t watermark : 1;
         std::uint8_t overrun : 1;
+        std::uint8_t watermark : 1;
+        std::uint8_t free_fall : 1;
+        std::uint8_t inactivity : 1;
+        std::uint8_t activity : 1;
+        std::uint8_t double_tap : 1;
+        std::uint8_t single_tap : 1;
+        std::uint8_t data_ready : 1;
     } PACKED;
 
     struct INT_SOURCE {
-        std::uint8_t data_ready : 1;
-        std::uint8_t single_tap : 1;
-        std::uint8_t double_tap : 1;
-        std::uint8_t activity : 1;
-        std::uint8_t inactivity : 1;
-        std::uint8_t free_fall : 1;
-        std::uint8_t watermark : 1;
         std::uint8_t overrun : 1;
+        std::uint8_t watermark : 1;
+        std::uint8_t free_fall : 1;
+        std::uint8_t inactivity : 1;
+        std::uint8_t activity : 1;
+        std::uint8_t double_tap : 1;
+        std::uint8_t single_tap : 1;
+        std::uint8_t data_ready : 1;
     } PACKED;
 
     struct DATA_FORMAT {
-        std::uint8_t self_test : 1;
-        std::uint8_t spi : 1;
-        std::uint8_t int_invert : 1;
-        std::uint8_t : 1;
-        std::uint8_t full_res : 1;
-        std::uint8_t justify : 1;
         std::uint8_t range : 2;
+        std::uint8_t justify : 1;
+        std::uint8_t full_res : 1;
+        std::uint8_t : 1;
+        std::uint8_t int_invert : 1;
+        std::uint8_t spi : 1;
+        std::uint8_t self_test : 1;
     } PACKED;
 
     struct DATA_X {
@@ -166,15 +166,21 @@ namespace ADXL345 {
     } PACKED;
 
     struct FIFO_CTL {
-        std::uint8_t fifo_mode : 2;
-        std::uint8_t trigger : 1;
         std::uint8_t samples : 5;
+        std::uint8_t trigger : 1;
+        std::uint8_t fifo_mode : 2;
     } PACKED;
 
     struct FIFO_STATUS {
-        std::uint8_t fifo_trig : 1;
-        std::uint8_t : 1;
         std::uint8_t entries : 6;
+        std::uint8_t : 1;
+        std::uint8_t fifo_trig : 1;
+    } PACKED;
+
+    struct FIFO_DATA {
+        DATA data;
+        FIFO_CTL fifo_ctl;
+        FIFO_STATUS fifo_status;
     } PACKED;
 
     struct Config {
@@ -200,6 +206,21 @@ namespace ADXL345 {
         FIFO_CTL fifo_ctl{};
     };
 
+    struct ActivityConfig {
+        THRESH_ACT thresh_act{};
+        THRESH_INACT thresh_inact{};
+        TIME_INACT time_inact{};
+        ACT_INACT_CTL act_inact_ctl{};
+    };
+
+    struct PowerProfile {
+        BW_RATE bw_rate{};
+        POWER_CTL power_ctl{};
+        INT_ENABLE int_enable{};
+        INT_MAP int_map{};
+        FIFO_CTL fifo_ctl{};
+    };
+
 }; // namespace ADXL345
 
 #undef PACKED
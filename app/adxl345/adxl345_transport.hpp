@@ -0,0 +1,63 @@
+#ifndef ADXL345_TRANSPORT_HPP
+#define ADXL345_TRANSPORT_HPP
+
+#include "adxl345_config.hpp"
+#include <concepts>
+#include <cstdint>
+#include <span>
+
+namespace ADXL345 {
+
+    using TransferCallback = void (*)(void* const context, std::span<std::uint8_t const> const bytes) noexcept;
+
+    template <typename Device>
+    concept BusDevice = requires(Device const& device,
+                                 std::uint8_t const reg_address,
+                                 std::uint8_t const byte,
+                                 std::span<std::uint8_t> const bytes,
+                                 std::span<std::uint8_t const> const const_bytes) {
+        { device.read_byte(reg_address) } noexcept -> std::same_as<Expected<std::uint8_t>>;
+        { device.read_bytes(reg_address, bytes) } noexcept -> std::same_as<Expected<void>>;
+        { device.write_byte(reg_address, byte) } noexcept -> std::same_as<Expected<void>>;
+        { device.write_bytes(reg_address, const_bytes) } noexcept -> std::same_as<Expected<void>>;
+    };
+
+    template <typename Device>
+    concept DMADevice = requires(Device const& device,
+                                 std::uint8_t const reg_address,
+                                 std::span<std::uint8_t> const bytes,
+                                 TransferCallback const callback,
+                                 void* const context) {
+        { device.read_bytes_dma(reg_address, bytes, callback, context) } noexcept -> std::same_as<Expected<void>>;
+        { device.is_busy() } noexcept -> std::same_as<bool>;
+    };
+
+    template <typename Device>
+    bool constexpr IS_FAST_BURST = requires { requires Device::FAST_BURST; };
+
+    struct NullDMADevice {
+    public:
+        Expected<void> read_bytes_dma(std::uint8_t const reg_address,
+                                      std::span<std::uint8_t> const bytes,
+                                      TransferCallback const callback,
+                                      void* const context) const noexcept;
+
+        bool is_busy() const noexcept;
+    };
+
+    inline Expected<void> NullDMADevice::read_bytes_dma(std::uint8_t const,
+                                                        std::span<std::uint8_t> const,
+                                                        TransferCallback const,
+                                                        void* const) const noexcept
+    {
+        return ::BusError::Unexpected{BusError::BUS_FAULT};
+    }
+
+    inline bool NullDMADevice::is_busy() const noexcept
+    {
+        return false;
+    }
+
+}; // namespace ADXL345
+
+#endif // ADXL345_TRANSPORT_HPP
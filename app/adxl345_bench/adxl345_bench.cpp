@@ -0,0 +1,592 @@
+#include "activity_controller.hpp"
+#include "adxl345.hpp"
+#include "adxl345_sim.hpp"
+#include "event_dispatcher.hpp"
+#include "low_power_policy.hpp"
+#include "resampler.hpp"
+#include "ring_buffer.hpp"
+#include "scale_kernel.hpp"
+#include "timestamp_reconstructor.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <utility>
+
+namespace {
+
+    std::size_t constexpr ITERATIONS = 100'000UZ;
+    std::size_t constexpr RING_BUFFER_SIZE = 256UZ;
+
+    std::uint32_t constexpr TICK_FREQUENCY = 80'000'000U;
+    float constexpr SENSOR_DRIFT = 0.02F;
+    std::uint32_t constexpr INTERRUPT_JITTER_TICKS = 40U;
+
+    struct Bus {
+        ADXL345Sim::BusProtocol protocol{};
+        std::uint32_t clock_hz{};
+        char const* name{nullptr};
+    };
+
+    std::array<Bus, 3UZ> constexpr BUSES = {Bus{.protocol = ADXL345Sim::BusProtocol::I2C, .clock_hz = 0U, .name = ""},
+                                            Bus{.protocol = ADXL345Sim::BusProtocol::I2C,
+                                                .clock_hz = 400'000U,
+                                                .name = ", i2c 400 kHz"},
+                                            Bus{.protocol = ADXL345Sim::BusProtocol::SPI,
+                                                .clock_hz = 5'000'000U,
+                                                .name = ", spi 5 MHz"}};
+
+    ADXL345::Config constexpr CONFIG = {
+        .bw_rate = {.rate = std::to_underlying(ADXL345::DataRate::RATE_3200HZ), .low_power = 0U},
+        .power_ctl = {.wakeup = 0U, .sleep = 0U, .measure = 1U, .auto_sleep = 0U, .link = 0U},
+        .data_format = {.range = std::to_underlying(ADXL345::Range::FS_16G),
+                        .justify = 0U,
+                        .full_res = 1U,
+                        .int_invert = 0U,
+                        .spi = 0U,
+                        .self_test = 0U},
+        .fifo_ctl = {.samples = 0U, .trigger = 0U, .fifo_mode = std::to_underlying(ADXL345::FifoMode::BYPASS)}};
+
+    ADXL345Sim::Waveform constexpr WAVEFORM = {.offset = {0.0F, 0.0F, 1.0F},
+                                               .amplitude = {0.5F, 0.25F, 0.125F},
+                                               .frequency = {50.0F, 120.0F, 400.0F}};
+
+    ADXL345Sim::Waveform constexpr REST_WAVEFORM = {.offset = {0.05F, -0.03F, 1.02F}, .amplitude = {}, .frequency = {}};
+
+    std::size_t constexpr CALIBRATION_SAMPLES = 64UZ;
+    ADXL345::Vec3D<std::int32_t> constexpr CALIBRATION_EXPECTED_MILLI_G = {0, 0, 1000};
+
+    ADXL345Sim::Waveform constexpr MOTION_WAVEFORM = {.offset = {0.0F, 0.0F, 1.0F},
+                                                      .amplitude = {0.5F, 0.5F, 0.0F},
+                                                      .frequency = {3.0F, 5.0F, 0.0F}};
+
+    ADXL345::ActivityConfig constexpr ACTIVITY_CONFIG = {.thresh_act = {.thresh_act = 4U},
+                                                         .thresh_inact = {.thresh_inact = 2U},
+                                                         .time_inact = {.time_inact = 2U},
+                                                         .act_inact_ctl = {.inact_z_en = 0U,
+                                                                           .inact_y_en = 1U,
+                                                                           .inact_x_en = 1U,
+                                                                           .inact_ac_dc = 0U,
+                                                                           .act_z_en = 0U,
+                                                                           .act_y_en = 1U,
+                                                                           .act_x_en = 1U,
+                                                                           .act_ac_dc = 0U}};
+
+    std::uint8_t constexpr CAPTURE_WATERMARK = 16U;
+    std::uint64_t constexpr NS_PER_MS = 1'000'000U;
+
+    std::size_t constexpr OVERRUN_BURSTS = 1'000UZ;
+    std::size_t constexpr OVERRUN_INTERVAL = 10UZ;
+    std::size_t constexpr OVERRUN_STALL_SAMPLES = 100UZ;
+
+    template <typename Function>
+    void benchmark(char const* const name, ADXL345Sim::ADXL345Sim& simulator, Function&& function) noexcept
+    {
+        simulator.clear_bus_statistics();
+
+        auto const start = std::chrono::steady_clock::now();
+        auto const samples = std::max(std::forward<Function>(function)(), 1UZ);
+        auto const elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start);
+
+        auto const& statistics = simulator.get_bus_statistics();
+        std::printf("%-32s %10.1f ns/sample %10.1f bus ns/sample %8.3f transactions/sample %8.3f bytes/sample\n",
+                    name,
+                    elapsed.count() / static_cast<double>(samples),
+                    static_cast<double>(statistics.bus_time_ns) / static_cast<double>(samples),
+                    static_cast<double>(statistics.transactions) / static_cast<double>(samples),
+                    static_cast<double>(statistics.bytes_read + statistics.bytes_written) /
+                        static_cast<double>(samples));
+    }
+
+    template <typename Function>
+    void benchmark_kernel(char const* const name, Function&& function) noexcept
+    {
+        auto const start = std::chrono::steady_clock::now();
+        auto const samples = std::max(std::forward<Function>(function)(), 1UZ);
+        auto const elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start);
+
+        std::printf("%-32s %10.1f ns/sample\n", name, elapsed.count() / static_cast<double>(samples));
+    }
+
+    template <typename Sensor>
+    void benchmark_fifo_drain(ADXL345Sim::ADXL345Sim& simulator, Sensor& adxl345, char const* const bus_name) noexcept
+    {
+        auto volatile sink = 0.0F;
+
+        for (auto const watermark : {8UZ, 16UZ, 31UZ}) {
+            adxl345.start_fifo_streaming(ADXL345::FifoMode::STREAM,
+                                         static_cast<std::uint8_t>(watermark),
+                                         ADXL345::InterruptPin::INT1);
+
+            std::array<ADXL345::Vec3D<float>, ADXL345::FIFO_SIZE> samples{};
+            auto const bursts = ITERATIONS / watermark;
+
+            char name[40]{};
+            std::snprintf(name, sizeof(name), "fifo drain (wm %zu%s)", watermark, bus_name);
+
+            benchmark(name, simulator, [&] {
+                auto drained = 0UZ;
+                for (auto burst = 0UZ; burst < bursts; ++burst) {
+                    simulator.advance_samples(watermark);
+                    if (auto const count = adxl345.drain_fifo_scaled(samples).value_or(0UZ); count > 0UZ) {
+                        sink = sink + samples[count - 1UZ].x;
+                        drained += count;
+                    }
+                }
+                return drained;
+            });
+
+            adxl345.stop_fifo_streaming();
+        }
+    }
+
+    std::uint32_t get_milliseconds(void* const context) noexcept
+    {
+        return static_cast<std::uint32_t>(static_cast<ADXL345Sim::ADXL345Sim*>(context)->get_time() / NS_PER_MS);
+    }
+
+    void count_event(void* const context, EventDispatcher::Event const&) noexcept
+    {
+        ++*static_cast<std::size_t*>(context);
+    }
+
+    template <typename T>
+    bool is_bit_exact(std::span<T const> const lhs, std::span<T const> const rhs) noexcept
+    {
+        return lhs.size() == rhs.size() && std::memcmp(lhs.data(), rhs.data(), lhs.size_bytes()) == 0;
+    }
+
+}; // namespace
+
+int main()
+{
+    ADXL345Sim::ADXL345Sim simulator{};
+    simulator.set_waveform(WAVEFORM);
+
+    simulator.clear_bus_statistics();
+    ADXL345::ADXL345<ADXL345Sim::I2CDevice> adxl345{ADXL345Sim::I2CDevice{&simulator}, CONFIG};
+    std::printf("%-32s %10llu transactions\n",
+                "initialize",
+                static_cast<unsigned long long>(simulator.get_bus_statistics().transactions));
+
+    benchmark("set data rate", simulator, [&] {
+        for (auto iteration = 0UZ; iteration < ITERATIONS; ++iteration) {
+            adxl345.set_data_rate(iteration % 2UZ == 0UZ ? ADXL345::DataRate::RATE_1600HZ
+                                                         : ADXL345::DataRate::RATE_3200HZ);
+        }
+        return ITERATIONS;
+    });
+    std::printf("%-32s %10s\n", "verify registers", adxl345.verify_registers() ? "ok" : "mismatch");
+
+    auto volatile sink = 0.0F;
+    auto volatile milli_g_sink = std::int32_t{};
+
+    benchmark("poll scaled", simulator, [&] {
+        for (auto iteration = 0UZ; iteration < ITERATIONS; ++iteration) {
+            simulator.advance_samples(1UZ);
+            sink = sink + adxl345.get_acceleration_scaled().value_or(ADXL345::Vec3D<float>{}).x;
+        }
+        return ITERATIONS;
+    });
+
+    benchmark("poll milli-g", simulator, [&] {
+        for (auto iteration = 0UZ; iteration < ITERATIONS; ++iteration) {
+            simulator.advance_samples(1UZ);
+            milli_g_sink = milli_g_sink + adxl345.get_acceleration_milli_g().value_or(ADXL345::Vec3D<std::int32_t>{}).x;
+        }
+        return ITERATIONS;
+    });
+
+    for (auto const& bus : BUSES) {
+        simulator.set_bus_protocol(bus.protocol);
+        simulator.set_bus_clock(bus.clock_hz);
+
+        if (bus.protocol == ADXL345Sim::BusProtocol::SPI) {
+            ADXL345::ADXL345<ADXL345Sim::SPIDevice> spi_adxl345{ADXL345Sim::SPIDevice{&simulator}, CONFIG};
+            benchmark_fifo_drain(simulator, spi_adxl345, bus.name);
+        } else {
+            benchmark_fifo_drain(simulator, adxl345, bus.name);
+        }
+    }
+    adxl345.resync_registers();
+
+    simulator.set_bus_protocol(ADXL345Sim::BusProtocol::I2C);
+    simulator.set_bus_clock(0U);
+
+    for (auto const watermark : {8UZ, 16UZ, 31UZ}) {
+        adxl345.start_fifo_streaming(ADXL345::FifoMode::STREAM,
+                                     static_cast<std::uint8_t>(watermark),
+                                     ADXL345::InterruptPin::INT1);
+
+        ADXL345::SampleBlock<std::int16_t, ADXL345::FIFO_SIZE> block{};
+        auto const bursts = ITERATIONS / watermark;
+
+        char name[40]{};
+        std::snprintf(name, sizeof(name), "fifo drain block (wm %zu)", watermark);
+
+        benchmark(name, simulator, [&] {
+            auto drained = 0UZ;
+            for (auto burst = 0UZ; burst < bursts; ++burst) {
+                simulator.advance_samples(watermark);
+                block.clear();
+                if (auto const count = adxl345.drain_fifo_block(block).value_or(0UZ); count > 0UZ) {
+                    milli_g_sink = milli_g_sink + block.get_x().back();
+                    drained += count;
+                }
+            }
+            return drained;
+        });
+
+        adxl345.stop_fifo_streaming();
+    }
+
+    simulator.set_waveform(REST_WAVEFORM);
+    simulator.set_bus_clock(400'000U);
+
+    auto offsets = std::optional<ADXL345::Vec3D<std::int8_t>>{};
+    benchmark("calibrate offsets (i2c 400 kHz)", simulator, [&] {
+        offsets =
+            adxl345.calibrate_offsets(CALIBRATION_SAMPLES, CALIBRATION_EXPECTED_MILLI_G, get_milliseconds, &simulator);
+        return CALIBRATION_SAMPLES;
+    });
+
+    simulator.advance_samples(1UZ);
+    auto const residual = adxl345.get_acceleration_milli_g().value_or(ADXL345::Vec3D<std::int32_t>{});
+    std::printf("%-32s %10s offsets %d %d %d residual %ld %ld %ld mg\n",
+                "calibrated",
+                offsets.has_value() ? "ok" : "failed",
+                offsets.value_or(ADXL345::Vec3D<std::int8_t>{}).x,
+                offsets.value_or(ADXL345::Vec3D<std::int8_t>{}).y,
+                offsets.value_or(ADXL345::Vec3D<std::int8_t>{}).z,
+                static_cast<long>(residual.x - CALIBRATION_EXPECTED_MILLI_G.x),
+                static_cast<long>(residual.y - CALIBRATION_EXPECTED_MILLI_G.y),
+                static_cast<long>(residual.z - CALIBRATION_EXPECTED_MILLI_G.z));
+
+    ActivityController::ActivityController activity_controller{
+        ActivityController::make_capture_profile(ADXL345::DataRate::RATE_800HZ,
+                                                 CAPTURE_WATERMARK,
+                                                 ADXL345::InterruptPin::INT1),
+        ActivityController::make_idle_profile(ActivityController::DEFAULT_IDLE_DATA_RATE,
+                                              ADXL345::FIFO_MAX_WATERMARK,
+                                              ADXL345::InterruptPin::INT1)};
+
+    adxl345.set_activity_config(ACTIVITY_CONFIG);
+    adxl345.start_fifo_streaming(ADXL345::FifoMode::STREAM, CAPTURE_WATERMARK, ADXL345::InterruptPin::INT1);
+    adxl345.set_power_profile(activity_controller.get_profile());
+
+    ADXL345::SampleBlock<std::int16_t, ADXL345::FIFO_SIZE> adaptive_block{};
+    std::array<std::uint64_t, 2UZ> mode_transactions{};
+    std::array<std::uint64_t, 2UZ> mode_milliseconds{};
+    auto const adaptive_lost_samples = simulator.get_lost_samples();
+
+    auto const run_adaptive = [&](ADXL345Sim::Waveform const& waveform, std::size_t const milliseconds) {
+        simulator.set_waveform(waveform);
+        for (auto millisecond = 0UZ; millisecond < milliseconds; ++millisecond) {
+            auto const mode = std::to_underlying(activity_controller.get_mode());
+            auto const transactions = simulator.get_bus_statistics().transactions;
+
+            simulator.advance_time(NS_PER_MS);
+            if (simulator.get_int1()) {
+                auto const int_source = adxl345.get_interrupt_source();
+                adaptive_block.clear();
+                adxl345.drain_fifo_block(adaptive_block);
+
+                if (int_source.has_value()) {
+                    if (auto const power_profile = activity_controller.update(*int_source);
+                        power_profile.has_value()) {
+                        adaptive_block.clear();
+                        adxl345.drain_fifo_block(adaptive_block);
+                        adxl345.set_power_profile(*power_profile);
+                    }
+                }
+            }
+
+            mode_transactions[mode] += simulator.get_bus_statistics().transactions - transactions;
+            ++mode_milliseconds[mode];
+        }
+    };
+
+    run_adaptive(MOTION_WAVEFORM, 2'000UZ);
+    run_adaptive(REST_WAVEFORM, 10'000UZ);
+    run_adaptive(MOTION_WAVEFORM, 5'000UZ);
+    run_adaptive(REST_WAVEFORM, 10'000UZ);
+
+    auto const transactions_per_second = [&](ActivityController::Mode const mode) {
+        auto const index = std::to_underlying(mode);
+        return static_cast<double>(mode_transactions[index]) * 1000.0 /
+               static_cast<double>(std::max(mode_milliseconds[index], std::uint64_t{1U}));
+    };
+    std::printf("%-32s %10.1f capture transactions/s %8.1f idle transactions/s %4u transitions %4llu lost\n",
+                "adaptive power (i2c 400 kHz)",
+                transactions_per_second(ActivityController::Mode::CAPTURE),
+                transactions_per_second(ActivityController::Mode::IDLE),
+                activity_controller.get_transitions(),
+                static_cast<unsigned long long>(simulator.get_lost_samples() - adaptive_lost_samples));
+
+    adxl345.stop_fifo_streaming();
+    adxl345.set_power_profile(ADXL345::PowerProfile{.bw_rate = CONFIG.bw_rate,
+                                                    .power_ctl = CONFIG.power_ctl,
+                                                    .int_enable = CONFIG.int_enable,
+                                                    .int_map = CONFIG.int_map,
+                                                    .fifo_ctl = CONFIG.fifo_ctl});
+
+    adxl345.set_data_rate(ADXL345::DataRate::RATE_800HZ);
+    adxl345.start_fifo_streaming(ADXL345::FifoMode::STREAM, CAPTURE_WATERMARK, ADXL345::InterruptPin::INT1);
+
+    auto const to_ticks = [&simulator] {
+        return static_cast<std::uint32_t>(simulator.get_time() * TICK_FREQUENCY / 1'000'000'000ULL);
+    };
+
+    TimestampReconstructor::TimestampReconstructor overrun_reconstructor{
+        TICK_FREQUENCY,
+        ADXL345::data_rate_to_frequency(ADXL345::DataRate::RATE_800HZ)};
+    std::array<std::uint32_t, ADXL345::FIFO_SIZE> overrun_timestamps{};
+    auto const overrun_lost_samples = simulator.get_lost_samples();
+    auto overruns = 0UZ;
+    auto estimated_lost_samples = 0UZ;
+
+    for (auto burst = 0UZ; burst < OVERRUN_BURSTS; ++burst) {
+        simulator.advance_samples(burst % OVERRUN_INTERVAL == OVERRUN_INTERVAL - 1UZ ? OVERRUN_STALL_SAMPLES
+                                                                                      : CAPTURE_WATERMARK);
+
+        auto const int_source = adxl345.get_interrupt_source();
+        if (int_source.has_value() && int_source->overrun == 1U) {
+            ++overruns;
+            estimated_lost_samples +=
+                overrun_reconstructor.recover(to_ticks(), adxl345.get_fifo_entries().value_or(ADXL345::FIFO_SIZE));
+        } else {
+            overrun_reconstructor.capture(to_ticks(), CAPTURE_WATERMARK);
+        }
+
+        adaptive_block.clear();
+        auto const drained = adxl345.drain_fifo_block(adaptive_block).value_or(0UZ);
+        overrun_reconstructor.reconstruct(std::span{overrun_timestamps}.first(drained));
+    }
+    std::printf("%-32s %10zu overruns %10zu estimated lost %10llu true lost\n",
+                "overrun accounting",
+                overruns,
+                estimated_lost_samples,
+                static_cast<unsigned long long>(simulator.get_lost_samples() - overrun_lost_samples));
+
+    struct WakeScenario {
+        char const* name{};
+        std::uint32_t drain_time_per_sample_us{};
+        ADXL345::DataRate data_rate{};
+        std::size_t watermark{};
+    };
+
+    std::array<WakeScenario, 4UZ> constexpr WAKE_SCENARIOS = {
+        WakeScenario{"wake budget i2c 800 Hz wm16", 260U, ADXL345::DataRate::RATE_800HZ, 16UZ},
+        WakeScenario{"wake budget spi 800 Hz wm16", 20U, ADXL345::DataRate::RATE_800HZ, 16UZ},
+        WakeScenario{"wake budget i2c 3200 Hz wm16", 260U, ADXL345::DataRate::RATE_3200HZ, 16UZ},
+        WakeScenario{"wake budget i2c 12.5 Hz wm31", 260U, ADXL345::DataRate::RATE_12HZ5, 31UZ}};
+
+    for (auto const& wake_scenario : WAKE_SCENARIOS) {
+        auto const wake_budget =
+            LowPowerPolicy::compute_wake_budget(LowPowerPolicy::Parameters{.wakeup_latency_us = 60U,
+                                                                           .drain_time_per_sample_us =
+                                                                               wake_scenario.drain_time_per_sample_us,
+                                                                           .process_time_us = 200U,
+                                                                           .min_stop_time_us = 1'000U,
+                                                                           .fifo_size = ADXL345::FIFO_SIZE},
+                                                ADXL345::data_rate_to_frequency(wake_scenario.data_rate),
+                                                wake_scenario.watermark);
+        auto const power_mode = LowPowerPolicy::select_power_mode(wake_budget, false);
+        std::printf("%-32s %10lu us active %10lu us stop %9.2f %% duty %s\n",
+                    wake_scenario.name,
+                    static_cast<unsigned long>(wake_budget.active_time_us),
+                    static_cast<unsigned long>(wake_budget.stop_time_us),
+                    static_cast<double>(wake_budget.duty_cycle * 100.0F),
+                    power_mode == LowPowerPolicy::PowerMode::STOP2 ? "stop2" : "sleep");
+    }
+
+    adxl345.stop_fifo_streaming();
+    adxl345.set_data_rate(static_cast<ADXL345::DataRate>(CONFIG.bw_rate.rate));
+
+    adxl345.set_offsets(ADXL345::Vec3D<std::int8_t>{});
+    simulator.set_bus_clock(0U);
+    simulator.set_waveform(WAVEFORM);
+
+    std::array<ADXL345::Vec3D<std::int16_t>, ADXL345::FIFO_SIZE> raw{};
+    for (auto index = 0UZ; index < raw.size(); ++index) {
+        auto const pattern = [index](std::size_t const step) {
+            return std::bit_cast<std::int16_t>(static_cast<std::uint16_t>(index * step));
+        };
+        raw[index] = ADXL345::Vec3D<std::int16_t>{pattern(2039UZ), pattern(4093UZ), pattern(65521UZ)};
+    }
+
+    auto const scale = ADXL345::config_to_scale(CONFIG);
+    auto const lsb_shift = ADXL345::config_to_lsb_shift(CONFIG);
+    auto const blocks = ITERATIONS / raw.size();
+
+    std::array<ADXL345::Vec3D<float>, ADXL345::FIFO_SIZE> reference_scaled{};
+    benchmark_kernel("scale reference", [&] {
+        for (auto block = 0UZ; block < blocks; ++block) {
+            ScaleKernel::raw_to_scaled_reference(raw, reference_scaled, scale);
+            sink = sink + reference_scaled.back().x;
+        }
+        return blocks * raw.size();
+    });
+
+    std::array<ADXL345::Vec3D<float>, ADXL345::FIFO_SIZE> kernel_scaled{};
+    benchmark_kernel("scale kernel", [&] {
+        for (auto block = 0UZ; block < blocks; ++block) {
+            ScaleKernel::raw_to_scaled(raw, kernel_scaled, scale);
+            sink = sink + kernel_scaled.back().x;
+        }
+        return blocks * raw.size();
+    });
+    std::printf("%-32s %10s\n",
+                "scale kernel output",
+                is_bit_exact<ADXL345::Vec3D<float>>(kernel_scaled, reference_scaled) ? "bit-exact" : "mismatch");
+
+    std::array<ADXL345::Vec3D<std::int32_t>, ADXL345::FIFO_SIZE> kernel_milli_g{};
+    benchmark_kernel("milli-g kernel", [&] {
+        for (auto block = 0UZ; block < blocks; ++block) {
+            ScaleKernel::raw_to_milli_g(raw, kernel_milli_g, lsb_shift);
+            milli_g_sink = milli_g_sink + kernel_milli_g.back().x;
+        }
+        return blocks * raw.size();
+    });
+
+    auto const nominal_rate = ADXL345::data_rate_to_frequency(ADXL345::DataRate::RATE_800HZ);
+    auto const true_period =
+        static_cast<double>(TICK_FREQUENCY) / static_cast<double>(nominal_rate * (1.0F + SENSOR_DRIFT));
+    auto const watermark = std::size_t{ADXL345::FIFO_MAX_WATERMARK};
+
+    TimestampReconstructor::TimestampReconstructor timestamp_reconstructor{TICK_FREQUENCY, nominal_rate};
+    std::array<std::uint32_t, ADXL345::FIFO_SIZE> timestamps{};
+    benchmark_kernel("timestamp reconstruction", [&] {
+        auto sample_index = 0UZ;
+        for (auto burst = 0UZ; burst < ITERATIONS / watermark; ++burst) {
+            auto const anchor_index = sample_index + watermark - 1UZ;
+            auto const ticks = static_cast<std::uint64_t>(static_cast<double>(anchor_index) * true_period);
+            auto const jitter = static_cast<std::uint32_t>(burst % 7UZ) * INTERRUPT_JITTER_TICKS;
+            timestamp_reconstructor.capture(static_cast<std::uint32_t>(ticks) + jitter, watermark);
+            timestamp_reconstructor.reconstruct(std::span{timestamps}.first(watermark));
+            sample_index += watermark;
+        }
+        return sample_index;
+    });
+    std::printf("%-32s %10.1f ppm (true %.1f ppm)\n",
+                "estimated drift",
+                static_cast<double>(timestamp_reconstructor.get_rate_estimator().get_drift_ppm()),
+                static_cast<double>(SENSOR_DRIFT) * 1'000'000.0);
+
+    Resampler::Resampler resampler{timestamp_reconstructor.get_rate_estimator().get_sample_rate(), nominal_rate};
+    std::array<ADXL345::Vec3D<float>, 2UZ * ADXL345::FIFO_SIZE> resampled{};
+    auto resampled_count = 0UZ;
+    benchmark_kernel("resample to nominal rate", [&] {
+        for (auto block = 0UZ; block < blocks; ++block) {
+            auto pending = std::span<ADXL345::Vec3D<float> const>{kernel_scaled};
+            while (!pending.empty()) {
+                auto const result = resampler.process(pending, resampled);
+                resampled_count += result.produced;
+                pending = pending.subspan(result.consumed);
+            }
+        }
+        return blocks * kernel_scaled.size();
+    });
+    std::printf("%-32s %10.4f output/input\n",
+                "resampled ratio",
+                static_cast<double>(resampled_count) / static_cast<double>(blocks * kernel_scaled.size()));
+
+    EventDispatcher::EventDispatcher event_dispatcher{};
+    auto handled_events = 0UZ;
+    event_dispatcher.register_handler(EventDispatcher::ALL_EVENTS, &count_event, &handled_events);
+
+    auto const tap_source = ADXL345::INT_SOURCE{.overrun = 0U,
+                                                .watermark = 1U,
+                                                .free_fall = 0U,
+                                                .inactivity = 0U,
+                                                .activity = 0U,
+                                                .double_tap = 1U,
+                                                .single_tap = 1U,
+                                                .data_ready = 1U};
+    auto const tap_status = ADXL345::ACT_TAP_STATUS{.tap_z_src = 0U,
+                                                    .tap_y_src = 0U,
+                                                    .tap_x_src = 1U,
+                                                    .asleep = 0U,
+                                                    .act_z_src = 0U,
+                                                    .act_y_src = 0U,
+                                                    .act_x_src = 0U};
+    benchmark_kernel("event decode + dispatch", [&] {
+        auto decoded = 0UZ;
+        for (auto iteration = 0UZ; iteration < ITERATIONS; ++iteration) {
+            decoded += event_dispatcher.decode(tap_source,
+                                               EventDispatcher::needs_act_tap_status(tap_source)
+                                                   ? std::optional<ADXL345::ACT_TAP_STATUS>{tap_status}
+                                                   : std::optional<ADXL345::ACT_TAP_STATUS>{std::nullopt},
+                                               static_cast<std::uint32_t>(iteration));
+            event_dispatcher.dispatch();
+        }
+        return decoded;
+    });
+    std::printf("%-32s %10zu handled %10lu dropped\n",
+                "events",
+                handled_events,
+                static_cast<unsigned long>(event_dispatcher.get_dropped_events()));
+
+    static RingBuffer::RingBuffer<ADXL345::Vec3D<std::int16_t>, RING_BUFFER_SIZE> ring_buffer{};
+    std::array<ADXL345::Vec3D<std::int16_t>, ADXL345::FIFO_SIZE> ring_block{};
+
+    benchmark_kernel("ring buffer per-element", [&] {
+        for (auto block = 0UZ; block < blocks; ++block) {
+            for (auto const& element : raw) {
+                ring_buffer.push(element);
+            }
+            for (auto& element : ring_block) {
+                element = ring_buffer.pop().value_or(ADXL345::Vec3D<std::int16_t>{});
+            }
+            milli_g_sink = milli_g_sink + ring_block.back().x;
+        }
+        return blocks * raw.size();
+    });
+
+    benchmark_kernel("ring buffer bulk", [&] {
+        for (auto block = 0UZ; block < blocks; ++block) {
+            ring_buffer.push_bulk(raw);
+            ring_buffer.pop_bulk(ring_block);
+            milli_g_sink = milli_g_sink + ring_block.back().x;
+        }
+        return blocks * raw.size();
+    });
+
+    benchmark_kernel("ring buffer span", [&] {
+        for (auto block = 0UZ; block < blocks; ++block) {
+            for (auto pushed = 0UZ; pushed < raw.size();) {
+                auto const push_span = ring_buffer.get_push_span();
+                auto const count = std::min(push_span.size(), raw.size() - pushed);
+                std::ranges::copy(std::span{raw}.subspan(pushed, count), push_span.begin());
+                ring_buffer.commit_push(count);
+                pushed += count;
+            }
+            while (!ring_buffer.is_empty()) {
+                auto const pop_span = ring_buffer.get_pop_span();
+                milli_g_sink = milli_g_sink + pop_span.back().x;
+                ring_buffer.commit_pop(pop_span.size());
+            }
+        }
+        return blocks * raw.size();
+    });
+
+    adxl345.clear_transport_statistics();
+    for (auto const bus_errors : {1UZ, 2UZ, 3UZ}) {
+        simulator.inject_bus_errors(ADXL345Sim::BusError::NACK, bus_errors);
+        simulator.advance_samples(1UZ);
+        std::printf("%-32s %10zu injected %10s\n",
+                    "poll with bus errors",
+                    bus_errors,
+                    adxl345.get_acceleration_scaled().has_value() ? "sample" : "dropped");
+    }
+
+    auto const& statistics = adxl345.get_transport_statistics();
+    std::printf("transport: %lu transactions %lu retries %lu failures\n",
+                static_cast<unsigned long>(statistics.transactions),
+                static_cast<unsigned long>(statistics.retries),
+                static_cast<unsigned long>(statistics.failures));
+    std::printf("lost samples: %llu\n", static_cast<unsigned long long>(simulator.get_lost_samples()));
+}
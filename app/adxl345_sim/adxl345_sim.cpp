@@ -0,0 +1,702 @@
+#include "adxl345_sim.hpp"
+#include "adxl345_register_map.hpp"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <numbers>
+#include <utility>
+
+namespace ADXL345Sim {
+
+    namespace {
+
+        std::uint64_t constexpr NS_PER_S = 1'000'000'000ULL;
+
+        float constexpr G_PER_OFFSET_LSB = 1.0F / 64.0F;
+        float constexpr G_PER_THRESHOLD_LSB = 0.0625F;
+        std::uint64_t constexpr NS_PER_DUR_LSB = 625'000ULL;
+        std::uint64_t constexpr NS_PER_TIME_FF_LSB = 5'000'000ULL;
+
+        std::uint64_t constexpr BITS_PER_I2C_BYTE = 9ULL;
+        std::size_t constexpr I2C_READ_FRAME_OVERHEAD = 3UZ;
+        std::size_t constexpr I2C_WRITE_FRAME_OVERHEAD = 2UZ;
+
+        std::uint64_t constexpr BITS_PER_SPI_BYTE = 8ULL;
+        std::size_t constexpr SPI_FRAME_OVERHEAD = 1UZ;
+
+        std::uint8_t constexpr DEVID_RESET = ADXL345::CHIP_ID;
+        std::uint8_t constexpr BW_RATE_RESET = 0x0AU;
+        std::uint8_t constexpr INT_SOURCE_RESET = 0x02U;
+
+        bool is_data_register(std::uint8_t const reg_address) noexcept
+        {
+            return reg_address >= std::to_underlying(RA::DATA_X0) && reg_address <= std::to_underlying(RA::DATA_Z1);
+        }
+
+        bool is_fifo_register(std::uint8_t const reg_address) noexcept
+        {
+            return is_data_register(reg_address) || reg_address == std::to_underlying(RA::FIFO_STATUS);
+        }
+
+        bool is_read_only_register(std::uint8_t const reg_address) noexcept
+        {
+            return ADXL345::get_register_access(reg_address) != ADXL345::Access::READ_WRITE;
+        }
+
+        float axis_sine(float const offset, float const amplitude, float const frequency, double const time_s) noexcept
+        {
+            return offset + amplitude * static_cast<float>(
+                                            std::sin(2.0 * std::numbers::pi * static_cast<double>(frequency) * time_s));
+        }
+
+    }; // namespace
+
+    ADXL345Sim::ADXL345Sim() noexcept
+    {
+        this->reset();
+    }
+
+    void ADXL345Sim::reset() noexcept
+    {
+        this->registers_.fill(0U);
+        this->registers_[std::to_underlying(RA::DEVID)] = DEVID_RESET;
+        this->registers_[std::to_underlying(RA::BW_RATE)] = BW_RATE_RESET;
+        this->registers_[std::to_underlying(RA::INT_SOURCE)] = INT_SOURCE_RESET;
+
+        this->fifo_head_ = 0UZ;
+        this->fifo_entries_ = 0UZ;
+        this->pop_pending_ = false;
+        this->output_ = {};
+        this->script_index_ = 0ULL;
+        this->next_sample_ns_ = this->time_ns_;
+        this->lost_samples_ = 0ULL;
+        this->inactive_ = false;
+        this->inactivity_reported_ = false;
+        this->free_falling_ = false;
+        this->free_fall_reported_ = false;
+        this->tapping_ = false;
+    }
+
+    void ADXL345Sim::set_source(AccelerationSource const source, void* const context) noexcept
+    {
+        this->source_ = source;
+        this->source_context_ = context;
+    }
+
+    void ADXL345Sim::set_waveform(Waveform const& waveform) noexcept
+    {
+        this->waveform_ = waveform;
+        this->set_source(&ADXL345Sim::waveform_source, this);
+    }
+
+    void ADXL345Sim::set_script(std::span<Vec3D const> const script) noexcept
+    {
+        this->script_ = script;
+        this->script_index_ = 0ULL;
+        this->set_source(&ADXL345Sim::script_source, this);
+    }
+
+    void ADXL345Sim::set_rate_error(float const rate_error) noexcept
+    {
+        this->rate_error_ = rate_error;
+    }
+
+    void ADXL345Sim::set_bus_clock(std::uint32_t const bus_clock_hz) noexcept
+    {
+        this->bus_clock_hz_ = bus_clock_hz;
+    }
+
+    void ADXL345Sim::set_bus_protocol(BusProtocol const bus_protocol) noexcept
+    {
+        this->bus_protocol_ = bus_protocol;
+    }
+
+    void ADXL345Sim::advance_time(std::uint64_t const nanoseconds) noexcept
+    {
+        auto const target_ns = this->time_ns_ + nanoseconds;
+        if (this->get_register<ADXL345::POWER_CTL>(RA::POWER_CTL).measure == 1U) {
+            while (this->next_sample_ns_ <= target_ns) {
+                this->time_ns_ = this->next_sample_ns_;
+                this->settle_fifo();
+                this->generate_sample();
+                this->next_sample_ns_ += this->get_sample_period();
+            }
+        }
+        this->time_ns_ = target_ns;
+    }
+
+    void ADXL345Sim::advance_samples(std::size_t const samples) noexcept
+    {
+        if (this->get_register<ADXL345::POWER_CTL>(RA::POWER_CTL).measure == 1U) {
+            for (auto sample = 0UZ; sample < samples; ++sample) {
+                this->time_ns_ = this->next_sample_ns_;
+                this->settle_fifo();
+                this->generate_sample();
+                this->next_sample_ns_ += this->get_sample_period();
+            }
+        }
+    }
+
+    std::uint64_t ADXL345Sim::get_time() const noexcept
+    {
+        return this->time_ns_;
+    }
+
+    std::uint64_t ADXL345Sim::get_idle_time() const noexcept
+    {
+        return this->time_ns_ - this->transaction_end_ns_;
+    }
+
+    std::uint64_t ADXL345Sim::get_sample_period() const noexcept
+    {
+        auto const output_data_rate = static_cast<double>(this->get_output_data_rate());
+        return static_cast<std::uint64_t>(std::llround(
+            static_cast<double>(NS_PER_S) / (output_data_rate * (1.0 + static_cast<double>(this->rate_error_)))));
+    }
+
+    float ADXL345Sim::get_output_data_rate() const noexcept
+    {
+        auto const rate = this->get_register<ADXL345::BW_RATE>(RA::BW_RATE).rate;
+        return 3200.0F / static_cast<float>(1U << (std::to_underlying(ADXL345::DataRate::RATE_3200HZ) - rate));
+    }
+
+    std::size_t ADXL345Sim::get_fifo_entries() const noexcept
+    {
+        return this->pop_pending_ && this->fifo_entries_ > 0UZ ? this->fifo_entries_ - 1UZ : this->fifo_entries_;
+    }
+
+    std::uint64_t ADXL345Sim::get_lost_samples() const noexcept
+    {
+        return this->lost_samples_;
+    }
+
+    bool ADXL345Sim::get_int1() const noexcept
+    {
+        auto const active = this->registers_[std::to_underlying(RA::INT_SOURCE)] &
+                            this->registers_[std::to_underlying(RA::INT_ENABLE)] &
+                            static_cast<std::uint8_t>(~this->registers_[std::to_underlying(RA::INT_MAP)]);
+        return (active != 0U) != (this->get_register<ADXL345::DATA_FORMAT>(RA::DATA_FORMAT).int_invert == 1U);
+    }
+
+    bool ADXL345Sim::get_int2() const noexcept
+    {
+        auto const active = this->registers_[std::to_underlying(RA::INT_SOURCE)] &
+                            this->registers_[std::to_underlying(RA::INT_ENABLE)] &
+                            this->registers_[std::to_underlying(RA::INT_MAP)];
+        return (active != 0U) != (this->get_register<ADXL345::DATA_FORMAT>(RA::DATA_FORMAT).int_invert == 1U);
+    }
+
+    Expected<void> ADXL345Sim::read(std::uint8_t const reg_address, std::span<std::uint8_t> const bytes) noexcept
+    {
+        ++this->bus_statistics_.transactions;
+        if (auto const result = this->take_bus_error(); !result.has_value()) {
+            return result;
+        }
+        this->bus_statistics_.bytes_read += bytes.size();
+
+        auto const bus_time = this->get_bus_time(bytes.size(), I2C_READ_FRAME_OVERHEAD);
+        this->bus_statistics_.bus_time_ns += bus_time;
+
+        auto address = reg_address;
+        if (this->bus_protocol_ == BusProtocol::SPI) {
+            auto const byte_time = this->get_spi_byte_time();
+            this->advance_time(SPI_FRAME_OVERHEAD * byte_time);
+            for (auto& byte : bytes) {
+                byte = this->read_register(address++);
+                this->advance_time(byte_time);
+            }
+        } else {
+            for (auto& byte : bytes) {
+                byte = this->read_register(address++);
+            }
+            this->advance_time(bus_time);
+        }
+
+        this->transaction_end_ns_ = this->time_ns_;
+        return {};
+    }
+
+    Expected<void> ADXL345Sim::write(std::uint8_t const reg_address, std::span<std::uint8_t const> const bytes) noexcept
+    {
+        ++this->bus_statistics_.transactions;
+        if (auto const result = this->take_bus_error(); !result.has_value()) {
+            return result;
+        }
+        this->bus_statistics_.bytes_written += bytes.size();
+
+        auto address = reg_address;
+        for (auto const byte : bytes) {
+            this->write_register(address++, byte);
+        }
+
+        auto const bus_time = this->get_bus_time(bytes.size(), I2C_WRITE_FRAME_OVERHEAD);
+        this->bus_statistics_.bus_time_ns += bus_time;
+        this->advance_time(bus_time);
+
+        this->transaction_end_ns_ = this->time_ns_;
+        return {};
+    }
+
+    void ADXL345Sim::inject_bus_errors(BusError const bus_error, std::size_t const count) noexcept
+    {
+        this->bus_error_ = bus_error;
+        this->bus_errors_ = count;
+    }
+
+    Expected<void> ADXL345Sim::take_bus_error() noexcept
+    {
+        if (this->bus_errors_ == 0UZ) {
+            return {};
+        }
+
+        --this->bus_errors_;
+        ++this->bus_statistics_.faults;
+        return ::BusError::Unexpected{this->bus_error_};
+    }
+
+    std::uint64_t ADXL345Sim::get_bus_time(std::size_t const bytes, std::size_t const i2c_frame_overhead) const noexcept
+    {
+        if (this->bus_clock_hz_ == 0U) {
+            return 0ULL;
+        } else if (this->bus_protocol_ == BusProtocol::SPI) {
+            return (SPI_FRAME_OVERHEAD + bytes) * BITS_PER_SPI_BYTE * NS_PER_S / this->bus_clock_hz_;
+        }
+        return (i2c_frame_overhead + bytes) * BITS_PER_I2C_BYTE * NS_PER_S / this->bus_clock_hz_;
+    }
+
+    std::uint64_t ADXL345Sim::get_spi_byte_time() const noexcept
+    {
+        return this->bus_clock_hz_ == 0U ? 0ULL : BITS_PER_SPI_BYTE * NS_PER_S / this->bus_clock_hz_;
+    }
+
+    BusStatistics const& ADXL345Sim::get_bus_statistics() const noexcept
+    {
+        return this->bus_statistics_;
+    }
+
+    void ADXL345Sim::clear_bus_statistics() noexcept
+    {
+        this->bus_statistics_ = {};
+    }
+
+    Vec3D ADXL345Sim::waveform_source(void* const context, std::uint64_t const time_ns) noexcept
+    {
+        auto const& waveform = static_cast<ADXL345Sim*>(context)->waveform_;
+        auto const time_s = static_cast<double>(time_ns) / static_cast<double>(NS_PER_S);
+        return Vec3D{axis_sine(waveform.offset.x, waveform.amplitude.x, waveform.frequency.x, time_s),
+                     axis_sine(waveform.offset.y, waveform.amplitude.y, waveform.frequency.y, time_s),
+                     axis_sine(waveform.offset.z, waveform.amplitude.z, waveform.frequency.z, time_s)};
+    }
+
+    Vec3D ADXL345Sim::script_source(void* const context, std::uint64_t const) noexcept
+    {
+        auto* const simulator = static_cast<ADXL345Sim*>(context);
+        if (simulator->script_.empty()) {
+            return Vec3D{};
+        }
+        return simulator->script_[simulator->script_index_++ % simulator->script_.size()];
+    }
+
+    template <typename Register>
+    inline Register ADXL345Sim::get_register(RA const reg_address) const noexcept
+    {
+        return std::bit_cast<Register>(this->registers_[std::to_underlying(reg_address)]);
+    }
+
+    template <typename Register>
+    inline void ADXL345Sim::set_register(RA const reg_address, Register const reg) noexcept
+    {
+        this->registers_[std::to_underlying(reg_address)] = std::bit_cast<std::uint8_t>(reg);
+    }
+
+    std::uint8_t ADXL345Sim::read_register(std::uint8_t const reg_address) noexcept
+    {
+        if (reg_address >= this->registers_.size()) {
+            return 0U;
+        }
+
+        this->settle_fifo();
+        if (this->pop_pending_ && is_fifo_register(reg_address)) {
+            ++this->bus_statistics_.fifo_timing_violations;
+        }
+
+        if (is_data_register(reg_address)) {
+            auto const fifo_mode = this->get_register<ADXL345::FIFO_CTL>(RA::FIFO_CTL).fifo_mode;
+            auto const& sample = fifo_mode != std::to_underlying(ADXL345::FifoMode::BYPASS) && this->fifo_entries_ > 0UZ
+                                     ? this->fifo_[this->fifo_head_]
+                                     : this->output_;
+            auto const byte = sample[reg_address - std::to_underlying(RA::DATA_X0)];
+            if (reg_address == std::to_underlying(RA::DATA_Z1) && this->bus_protocol_ == BusProtocol::SPI) {
+                if (!this->pop_pending_) {
+                    this->pop_pending_ = true;
+                    this->pop_ready_ns_ = this->time_ns_ + FIFO_POP_TIME_NS;
+                }
+            } else if (reg_address == std::to_underlying(RA::DATA_Z1)) {
+                this->pop_sample();
+            }
+            return byte;
+        }
+
+        auto const byte = this->registers_[reg_address];
+        if (reg_address == std::to_underlying(RA::INT_SOURCE)) {
+            auto int_source = this->get_register<ADXL345::INT_SOURCE>(RA::INT_SOURCE);
+            int_source.single_tap = 0U;
+            int_source.double_tap = 0U;
+            int_source.activity = 0U;
+            int_source.inactivity = 0U;
+            int_source.free_fall = 0U;
+            this->set_register(RA::INT_SOURCE, int_source);
+        }
+        return byte;
+    }
+
+    void ADXL345Sim::write_register(std::uint8_t const reg_address, std::uint8_t const byte) noexcept
+    {
+        if (reg_address >= this->registers_.size() || is_read_only_register(reg_address)) {
+            return;
+        }
+
+        auto const was_measuring = this->get_register<ADXL345::POWER_CTL>(RA::POWER_CTL).measure == 1U;
+        this->registers_[reg_address] = byte;
+
+        if (reg_address == std::to_underlying(RA::POWER_CTL)) {
+            if (!was_measuring && this->get_register<ADXL345::POWER_CTL>(RA::POWER_CTL).measure == 1U) {
+                this->next_sample_ns_ = this->time_ns_ + this->get_sample_period();
+            }
+        } else if (reg_address == std::to_underlying(RA::FIFO_CTL)) {
+            if (this->get_register<ADXL345::FIFO_CTL>(RA::FIFO_CTL).fifo_mode ==
+                std::to_underlying(ADXL345::FifoMode::BYPASS)) {
+                this->fifo_head_ = 0UZ;
+                this->fifo_entries_ = 0UZ;
+                this->pop_pending_ = false;
+            }
+        }
+
+        this->update_status();
+    }
+
+    void ADXL345Sim::generate_sample() noexcept
+    {
+        auto const acceleration =
+            this->source_ != nullptr ? this->source_(this->source_context_, this->time_ns_) : Vec3D{};
+
+        this->detect_events(acceleration);
+
+        auto const sample = this->encode_sample(acceleration);
+        if (this->get_register<ADXL345::FIFO_CTL>(RA::FIFO_CTL).fifo_mode ==
+            std::to_underlying(ADXL345::FifoMode::BYPASS)) {
+            auto int_source = this->get_register<ADXL345::INT_SOURCE>(RA::INT_SOURCE);
+            if (int_source.data_ready == 1U) {
+                int_source.overrun = 1U;
+                ++this->lost_samples_;
+            }
+            int_source.data_ready = 1U;
+            this->set_register(RA::INT_SOURCE, int_source);
+            this->output_ = sample;
+        } else {
+            this->push_sample(sample);
+        }
+
+        this->update_status();
+    }
+
+    void ADXL345Sim::detect_events(Vec3D const& acceleration) noexcept
+    {
+        auto const act_inact_ctl = this->get_register<ADXL345::ACT_INACT_CTL>(RA::ACT_INACT_CTL);
+        auto const int_enable = this->get_register<ADXL345::INT_ENABLE>(RA::INT_ENABLE);
+        auto int_source = this->get_register<ADXL345::INT_SOURCE>(RA::INT_SOURCE);
+        auto act_tap_status = this->get_register<ADXL345::ACT_TAP_STATUS>(RA::ACT_TAP_STATUS);
+
+        auto const above = [](float const value, std::uint8_t const threshold) {
+            return std::abs(value) > static_cast<float>(threshold) * G_PER_THRESHOLD_LSB;
+        };
+
+        auto const thresh_act = this->registers_[std::to_underlying(RA::THRESH_ACT)];
+        auto const act_x = act_inact_ctl.act_x_en == 1U && above(acceleration.x, thresh_act);
+        auto const act_y = act_inact_ctl.act_y_en == 1U && above(acceleration.y, thresh_act);
+        auto const act_z = act_inact_ctl.act_z_en == 1U && above(acceleration.z, thresh_act);
+        if (int_enable.activity == 1U && (act_x || act_y || act_z)) {
+            int_source.activity = 1U;
+            act_tap_status.act_x_src = act_x ? 1U : 0U;
+            act_tap_status.act_y_src = act_y ? 1U : 0U;
+            act_tap_status.act_z_src = act_z ? 1U : 0U;
+        }
+
+        auto const thresh_inact = this->registers_[std::to_underlying(RA::THRESH_INACT)];
+        auto const inactive = (act_inact_ctl.inact_x_en == 0U || !above(acceleration.x, thresh_inact)) &&
+                              (act_inact_ctl.inact_y_en == 0U || !above(acceleration.y, thresh_inact)) &&
+                              (act_inact_ctl.inact_z_en == 0U || !above(acceleration.z, thresh_inact));
+        if (inactive && !this->inactive_) {
+            this->inactivity_start_ns_ = this->time_ns_;
+        }
+        this->inactive_ = inactive;
+        if (!inactive) {
+            this->inactivity_reported_ = false;
+        } else if (!this->inactivity_reported_ &&
+                   this->time_ns_ - this->inactivity_start_ns_ >=
+                       this->registers_[std::to_underlying(RA::TIME_INACT)] * NS_PER_S) {
+            this->inactivity_reported_ = true;
+            if (int_enable.inactivity == 1U) {
+                int_source.inactivity = 1U;
+            }
+        }
+
+        auto const thresh_ff = this->registers_[std::to_underlying(RA::THRESH_FF)];
+        auto const free_falling =
+            !above(acceleration.x, thresh_ff) && !above(acceleration.y, thresh_ff) && !above(acceleration.z, thresh_ff);
+        if (free_falling && !this->free_falling_) {
+            this->free_fall_start_ns_ = this->time_ns_;
+        }
+        this->free_falling_ = free_falling;
+        if (!free_falling) {
+            this->free_fall_reported_ = false;
+        } else if (!this->free_fall_reported_ &&
+                   this->time_ns_ - this->free_fall_start_ns_ >=
+                       this->registers_[std::to_underlying(RA::TIME_FF)] * NS_PER_TIME_FF_LSB) {
+            this->free_fall_reported_ = true;
+            if (int_enable.free_fall == 1U) {
+                int_source.free_fall = 1U;
+            }
+        }
+
+        auto const tap_axes = this->get_register<ADXL345::TAP_AXES>(RA::TAP_AXES);
+        auto const thresh_tap = this->registers_[std::to_underlying(RA::THRESH_TAP)];
+        auto const tap_x = tap_axes.tap_x_en == 1U && above(acceleration.x, thresh_tap);
+        auto const tap_y = tap_axes.tap_y_en == 1U && above(acceleration.y, thresh_tap);
+        auto const tap_z = tap_axes.tap_z_en == 1U && above(acceleration.z, thresh_tap);
+        if (tap_x || tap_y || tap_z) {
+            if (!this->tapping_) {
+                this->tap_start_ns_ = this->time_ns_;
+                act_tap_status.tap_x_src = tap_x ? 1U : 0U;
+                act_tap_status.tap_y_src = tap_y ? 1U : 0U;
+                act_tap_status.tap_z_src = tap_z ? 1U : 0U;
+            }
+            this->tapping_ = true;
+        } else if (this->tapping_) {
+            this->tapping_ = false;
+            if (int_enable.single_tap == 1U &&
+                this->time_ns_ - this->tap_start_ns_ <=
+                    this->registers_[std::to_underlying(RA::DUR)] * NS_PER_DUR_LSB) {
+                int_source.single_tap = 1U;
+            }
+        }
+
+        this->set_register(RA::INT_SOURCE, int_source);
+        this->set_register(RA::ACT_TAP_STATUS, act_tap_status);
+    }
+
+    void ADXL345Sim::push_sample(Sample const& sample) noexcept
+    {
+        auto int_source = this->get_register<ADXL345::INT_SOURCE>(RA::INT_SOURCE);
+
+        if (this->fifo_entries_ == this->fifo_.size()) {
+            int_source.overrun = 1U;
+            ++this->lost_samples_;
+            if (this->get_register<ADXL345::FIFO_CTL>(RA::FIFO_CTL).fifo_mode ==
+                std::to_underlying(ADXL345::FifoMode::FIFO)) {
+                this->set_register(RA::INT_SOURCE, int_source);
+                return;
+            }
+            this->fifo_head_ = (this->fifo_head_ + 1UZ) % this->fifo_.size();
+            --this->fifo_entries_;
+        }
+
+        this->fifo_[(this->fifo_head_ + this->fifo_entries_) % this->fifo_.size()] = sample;
+        ++this->fifo_entries_;
+        this->set_register(RA::INT_SOURCE, int_source);
+    }
+
+    void ADXL345Sim::pop_sample() noexcept
+    {
+        if (this->get_register<ADXL345::FIFO_CTL>(RA::FIFO_CTL).fifo_mode !=
+                std::to_underlying(ADXL345::FifoMode::BYPASS) &&
+            this->fifo_entries_ > 0UZ) {
+            this->output_ = this->fifo_[this->fifo_head_];
+            this->fifo_head_ = (this->fifo_head_ + 1UZ) % this->fifo_.size();
+            --this->fifo_entries_;
+        }
+
+        auto int_source = this->get_register<ADXL345::INT_SOURCE>(RA::INT_SOURCE);
+        int_source.data_ready = 0U;
+        int_source.overrun = 0U;
+        this->set_register(RA::INT_SOURCE, int_source);
+
+        this->update_status();
+    }
+
+    void ADXL345Sim::settle_fifo() noexcept
+    {
+        if (this->pop_pending_ && this->time_ns_ >= this->pop_ready_ns_) {
+            this->pop_pending_ = false;
+            this->pop_sample();
+        }
+    }
+
+    void ADXL345Sim::update_status() noexcept
+    {
+        auto const fifo_ctl = this->get_register<ADXL345::FIFO_CTL>(RA::FIFO_CTL);
+        auto int_source = this->get_register<ADXL345::INT_SOURCE>(RA::INT_SOURCE);
+
+        if (fifo_ctl.fifo_mode != std::to_underlying(ADXL345::FifoMode::BYPASS)) {
+            int_source.data_ready = this->fifo_entries_ > 0UZ ? 1U : 0U;
+            int_source.watermark = this->fifo_entries_ >= fifo_ctl.samples ? 1U : 0U;
+        } else {
+            int_source.watermark = fifo_ctl.samples == 0U ? 1U : 0U;
+        }
+        this->set_register(RA::INT_SOURCE, int_source);
+
+        this->set_register(
+            RA::FIFO_STATUS,
+            ADXL345::FIFO_STATUS{.entries = static_cast<std::uint8_t>(this->fifo_entries_ & 0x3FU), .fifo_trig = 0U});
+    }
+
+    std::int16_t ADXL345Sim::encode_axis(float const acceleration, std::uint8_t const offset) const noexcept
+    {
+        auto const data_format = this->get_register<ADXL345::DATA_FORMAT>(RA::DATA_FORMAT);
+        auto const bits = data_format.full_res == 1U ? 10 + data_format.range : 10;
+        auto const g_per_lsb = data_format.full_res == 1U ? 1.0F / 256.0F
+                                                          : static_cast<float>(2 << data_format.range) / 512.0F;
+
+        auto const corrected =
+            acceleration + static_cast<float>(std::bit_cast<std::int8_t>(offset)) * G_PER_OFFSET_LSB;
+        auto const max = (1L << (bits - 1)) - 1L;
+        auto const value = std::clamp(std::lround(corrected / g_per_lsb), -max - 1L, max);
+
+        return static_cast<std::int16_t>(data_format.justify == 1U ? value * (1L << (16 - bits)) : value);
+    }
+
+    ADXL345Sim::Sample ADXL345Sim::encode_sample(Vec3D const& acceleration) const noexcept
+    {
+        auto const x = std::bit_cast<std::array<std::uint8_t, 2UZ>>(
+            this->encode_axis(acceleration.x, this->registers_[std::to_underlying(RA::OFSX)]));
+        auto const y = std::bit_cast<std::array<std::uint8_t, 2UZ>>(
+            this->encode_axis(acceleration.y, this->registers_[std::to_underlying(RA::OFSY)]));
+        auto const z = std::bit_cast<std::array<std::uint8_t, 2UZ>>(
+            this->encode_axis(acceleration.z, this->registers_[std::to_underlying(RA::OFSZ)]));
+        return Sample{x[0], x[1], y[0], y[1], z[0], z[1]};
+    }
+
+    I2CDevice::I2CDevice(ADXL345Sim* const simulator) noexcept : simulator_{simulator}
+    {}
+
+    Expected<void> I2CDevice::read_bytes(std::uint8_t const reg_address,
+                                         std::span<std::uint8_t> const bytes) const noexcept
+    {
+        if (this->simulator_ == nullptr) {
+            return ::BusError::Unexpected{BusError::NACK};
+        }
+
+        return this->simulator_->read(reg_address, bytes);
+    }
+
+    Expected<void> I2CDevice::write_bytes(std::uint8_t const reg_address,
+                                          std::span<std::uint8_t const> const bytes) const noexcept
+    {
+        if (this->simulator_ == nullptr) {
+            return ::BusError::Unexpected{BusError::NACK};
+        }
+
+        return this->simulator_->write(reg_address, bytes);
+    }
+
+    Expected<std::uint8_t> I2CDevice::read_byte(std::uint8_t const reg_address) const noexcept
+    {
+        auto byte = std::uint8_t{};
+        auto const result = this->read_bytes(reg_address, std::span{&byte, 1UZ});
+        return result.has_value() ? Expected<std::uint8_t>{byte}
+                                  : Expected<std::uint8_t>{::BusError::Unexpected{result.error()}};
+    }
+
+    Expected<void> I2CDevice::write_byte(std::uint8_t const reg_address, std::uint8_t const byte) const noexcept
+    {
+        return this->write_bytes(reg_address, std::span{&byte, 1UZ});
+    }
+
+    SPIDevice::SPIDevice(ADXL345Sim* const simulator, std::uint64_t const min_idle_ns) noexcept :
+        simulator_{simulator}, min_idle_ns_{min_idle_ns}
+    {}
+
+    Expected<void> SPIDevice::read_bytes(std::uint8_t const reg_address,
+                                         std::span<std::uint8_t> const bytes) const noexcept
+    {
+        if (this->simulator_ == nullptr) {
+            return ::BusError::Unexpected{BusError::BUS_FAULT};
+        }
+
+        this->wait_idle();
+        return this->simulator_->read(reg_address, bytes);
+    }
+
+    Expected<void> SPIDevice::write_bytes(std::uint8_t const reg_address,
+                                          std::span<std::uint8_t const> const bytes) const noexcept
+    {
+        if (this->simulator_ == nullptr) {
+            return ::BusError::Unexpected{BusError::BUS_FAULT};
+        }
+
+        this->wait_idle();
+        return this->simulator_->write(reg_address, bytes);
+    }
+
+    Expected<std::uint8_t> SPIDevice::read_byte(std::uint8_t const reg_address) const noexcept
+    {
+        auto byte = std::uint8_t{};
+        auto const result = this->read_bytes(reg_address, std::span{&byte, 1UZ});
+        return result.has_value() ? Expected<std::uint8_t>{byte}
+                                  : Expected<std::uint8_t>{::BusError::Unexpected{result.error()}};
+    }
+
+    Expected<void> SPIDevice::write_byte(std::uint8_t const reg_address, std::uint8_t const byte) const noexcept
+    {
+        return this->write_bytes(reg_address, std::span{&byte, 1UZ});
+    }
+
+    Expected<void> SPIDevice::read_bytes_dma(std::uint8_t const reg_address,
+                                             std::span<std::uint8_t> const bytes,
+                                             TransferCallback const callback,
+                                             void* const context) const noexcept
+    {
+        if (this->simulator_ == nullptr || callback == nullptr || bytes.empty()) {
+            return ::BusError::Unexpected{BusError::BUS_FAULT};
+        }
+
+        auto const result = this->read_bytes(reg_address, bytes);
+        callback(context, result.has_value() ? bytes : std::span<std::uint8_t>{});
+        return {};
+    }
+
+    bool SPIDevice::is_busy() const noexcept
+    {
+        return false;
+    }
+
+    void SPIDevice::wait_idle() const noexcept
+    {
+        if (auto const idle = this->simulator_->get_idle_time(); idle < this->min_idle_ns_) {
+            this->simulator_->advance_time(this->min_idle_ns_ - idle);
+        }
+    }
+
+    I2CDMADevice::I2CDMADevice(ADXL345Sim* const simulator) noexcept : simulator_{simulator}
+    {}
+
+    Expected<void> I2CDMADevice::read_bytes_dma(std::uint8_t const reg_address,
+                                                std::span<std::uint8_t> const bytes,
+                                                TransferCallback const callback,
+                                                void* const context) const noexcept
+    {
+        if (this->simulator_ == nullptr || callback == nullptr || bytes.empty()) {
+            return ::BusError::Unexpected{BusError::BUS_FAULT};
+        }
+
+        auto const result = this->simulator_->read(reg_address, bytes);
+        callback(context, result.has_value() ? bytes : std::span<std::uint8_t>{});
+        return {};
+    }
+
+    bool I2CDMADevice::is_busy() const noexcept
+    {
+        return false;
+    }
+
+}; // namespace ADXL345Sim
@@ -0,0 +1,234 @@
+#ifndef ADXL345_SIM_HPP
+#define ADXL345_SIM_HPP
+
+#include "adxl345_config.hpp"
+#include "adxl345_registers.hpp"
+#include "bus_error.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+
+namespace ADXL345Sim {
+
+    using Vec3D = ADXL345::Vec3D<float>;
+    using RA = ADXL345::RA;
+
+    using BusError = ::BusError::BusError;
+
+    template <typename T>
+    using Expected = ::BusError::Expected<T>;
+
+    using AccelerationSource = Vec3D (*)(void* const context, std::uint64_t const time_ns) noexcept;
+
+    using TransferCallback = void (*)(void* const context, std::span<std::uint8_t const> const bytes) noexcept;
+
+    std::uint64_t constexpr FIFO_POP_TIME_NS = 5'000ULL;
+
+    enum struct BusProtocol : std::uint8_t {
+        I2C,
+        SPI,
+    };
+
+    struct Waveform {
+        Vec3D offset{};
+        Vec3D amplitude{};
+        Vec3D frequency{};
+    };
+
+    struct BusStatistics {
+        std::uint64_t transactions{};
+        std::uint64_t bytes_read{};
+        std::uint64_t bytes_written{};
+        std::uint64_t faults{};
+        std::uint64_t bus_time_ns{};
+        std::uint64_t fifo_timing_violations{};
+    };
+
+    struct ADXL345Sim {
+    public:
+        ADXL345Sim() noexcept;
+
+        ADXL345Sim(ADXL345Sim const& other) = delete;
+        ADXL345Sim(ADXL345Sim&& other) noexcept = default;
+
+        ADXL345Sim& operator=(ADXL345Sim const& other) = delete;
+        ADXL345Sim& operator=(ADXL345Sim&& other) noexcept = default;
+
+        ~ADXL345Sim() noexcept = default;
+
+        void reset() noexcept;
+
+        void set_source(AccelerationSource const source, void* const context) noexcept;
+        void set_waveform(Waveform const& waveform) noexcept;
+        void set_script(std::span<Vec3D const> const script) noexcept;
+
+        void set_rate_error(float const rate_error) noexcept;
+
+        void set_bus_clock(std::uint32_t const bus_clock_hz) noexcept;
+        void set_bus_protocol(BusProtocol const bus_protocol) noexcept;
+
+        void advance_time(std::uint64_t const nanoseconds) noexcept;
+        void advance_samples(std::size_t const samples) noexcept;
+
+        std::uint64_t get_time() const noexcept;
+        std::uint64_t get_idle_time() const noexcept;
+        std::uint64_t get_sample_period() const noexcept;
+        float get_output_data_rate() const noexcept;
+
+        std::size_t get_fifo_entries() const noexcept;
+        std::uint64_t get_lost_samples() const noexcept;
+
+        bool get_int1() const noexcept;
+        bool get_int2() const noexcept;
+
+        void inject_bus_errors(BusError const bus_error, std::size_t const count) noexcept;
+
+        Expected<void> read(std::uint8_t const reg_address, std::span<std::uint8_t> const bytes) noexcept;
+        Expected<void> write(std::uint8_t const reg_address, std::span<std::uint8_t const> const bytes) noexcept;
+
+        BusStatistics const& get_bus_statistics() const noexcept;
+        void clear_bus_statistics() noexcept;
+
+    private:
+        using Sample = std::array<std::uint8_t, sizeof(ADXL345::DATA)>;
+
+        static Vec3D waveform_source(void* const context, std::uint64_t const time_ns) noexcept;
+        static Vec3D script_source(void* const context, std::uint64_t const time_ns) noexcept;
+
+        template <typename Register>
+        Register get_register(RA const reg_address) const noexcept;
+
+        template <typename Register>
+        void set_register(RA const reg_address, Register const reg) noexcept;
+
+        std::uint8_t read_register(std::uint8_t const reg_address) noexcept;
+        void write_register(std::uint8_t const reg_address, std::uint8_t const byte) noexcept;
+
+        void generate_sample() noexcept;
+        void detect_events(Vec3D const& acceleration) noexcept;
+        void push_sample(Sample const& sample) noexcept;
+        void pop_sample() noexcept;
+        void settle_fifo() noexcept;
+        void update_status() noexcept;
+
+        Expected<void> take_bus_error() noexcept;
+
+        std::uint64_t get_bus_time(std::size_t const bytes, std::size_t const i2c_frame_overhead) const noexcept;
+        std::uint64_t get_spi_byte_time() const noexcept;
+
+        std::int16_t encode_axis(float const acceleration, std::uint8_t const offset) const noexcept;
+        Sample encode_sample(Vec3D const& acceleration) const noexcept;
+
+        std::array<std::uint8_t, std::to_underlying(RA::FIFO_STATUS) + 1UZ> registers_{};
+
+        std::array<Sample, ADXL345::FIFO_SIZE> fifo_{};
+        std::size_t fifo_head_{};
+        std::size_t fifo_entries_{};
+
+        bool pop_pending_{false};
+        std::uint64_t pop_ready_ns_{};
+
+        Sample output_{};
+
+        AccelerationSource source_{nullptr};
+        void* source_context_{nullptr};
+
+        Waveform waveform_{};
+        std::span<Vec3D const> script_{};
+        std::uint64_t script_index_{};
+
+        float rate_error_{};
+
+        std::uint32_t bus_clock_hz_{};
+        BusProtocol bus_protocol_{BusProtocol::I2C};
+
+        std::uint64_t time_ns_{};
+        std::uint64_t next_sample_ns_{};
+        std::uint64_t transaction_end_ns_{};
+        std::uint64_t lost_samples_{};
+
+        std::uint64_t inactivity_start_ns_{};
+        std::uint64_t free_fall_start_ns_{};
+        std::uint64_t tap_start_ns_{};
+
+        bool inactive_{false};
+        bool inactivity_reported_{false};
+        bool free_falling_{false};
+        bool free_fall_reported_{false};
+        bool tapping_{false};
+
+        BusStatistics bus_statistics_{};
+
+        BusError bus_error_{};
+        std::size_t bus_errors_{};
+    };
+
+    struct I2CDevice {
+    public:
+        I2CDevice() noexcept = default;
+        I2CDevice(ADXL345Sim* const simulator) noexcept;
+
+        Expected<void> read_bytes(std::uint8_t const reg_address, std::span<std::uint8_t> const bytes) const noexcept;
+
+        Expected<std::uint8_t> read_byte(std::uint8_t const reg_address) const noexcept;
+
+        Expected<void> write_bytes(std::uint8_t const reg_address,
+                                   std::span<std::uint8_t const> const bytes) const noexcept;
+
+        Expected<void> write_byte(std::uint8_t const reg_address, std::uint8_t const byte) const noexcept;
+
+    private:
+        ADXL345Sim* simulator_{nullptr};
+    };
+
+    struct SPIDevice {
+    public:
+        static bool constexpr FAST_BURST = true;
+
+        SPIDevice() noexcept = default;
+        SPIDevice(ADXL345Sim* const simulator, std::uint64_t const min_idle_ns = FIFO_POP_TIME_NS) noexcept;
+
+        Expected<void> read_bytes(std::uint8_t const reg_address, std::span<std::uint8_t> const bytes) const noexcept;
+
+        Expected<std::uint8_t> read_byte(std::uint8_t const reg_address) const noexcept;
+
+        Expected<void> write_bytes(std::uint8_t const reg_address,
+                                   std::span<std::uint8_t const> const bytes) const noexcept;
+
+        Expected<void> write_byte(std::uint8_t const reg_address, std::uint8_t const byte) const noexcept;
+
+        Expected<void> read_bytes_dma(std::uint8_t const reg_address,
+                                      std::span<std::uint8_t> const bytes,
+                                      TransferCallback const callback,
+                                      void* const context) const noexcept;
+
+        bool is_busy() const noexcept;
+
+    private:
+        void wait_idle() const noexcept;
+
+        ADXL345Sim* simulator_{nullptr};
+        std::uint64_t min_idle_ns_{};
+    };
+
+    struct I2CDMADevice {
+    public:
+        I2CDMADevice() noexcept = default;
+        I2CDMADevice(ADXL345Sim* const simulator) noexcept;
+
+        Expected<void> read_bytes_dma(std::uint8_t const reg_address,
+                                      std::span<std::uint8_t> const bytes,
+                                      TransferCallback const callback,
+                                      void* const context) const noexcept;
+
+        bool is_busy() const noexcept;
+
+    private:
+        ADXL345Sim* simulator_{nullptr};
+    };
+
+}; // namespace ADXL345Sim
+
+#endif // ADXL345_SIM_HPP
@@ -0,0 +1,434 @@
+#include "adxl345.hpp"
+#include "adxl345_sim.hpp"
+#include "timestamp_reconstructor.hpp"
+#include "unit_test.hpp"
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <optional>
+#include <span>
+#include <utility>
+
+namespace {
+
+    std::uint32_t constexpr TICK_FREQUENCY = 80'000'000U;
+    std::uint64_t constexpr NS_PER_S = 1'000'000'000ULL;
+    std::uint64_t constexpr NS_PER_MS = 1'000'000ULL;
+
+    std::uint8_t constexpr WATERMARK = 16U;
+    std::size_t constexpr STALL_SAMPLES = 100UZ;
+
+    std::uint32_t constexpr I2C_BUS_CLOCK_HZ = 400'000U;
+    std::uint32_t constexpr SPI_BUS_CLOCK_HZ = 5'000'000U;
+
+    std::size_t constexpr CALIBRATION_SAMPLES = 64UZ;
+    ADXL345::Vec3D<std::int32_t> constexpr CALIBRATION_EXPECTED_MILLI_G = {0, 0, 1000};
+    std::int32_t constexpr CALIBRATION_TOLERANCE_MILLI_G = 16;
+    std::uint32_t constexpr CALIBRATION_SHORT_TIMEOUT_MS = 1U;
+    ADXL345::Vec3D<std::int8_t> constexpr PREVIOUS_OFFSETS = {3, -2, 1};
+
+    ADXL345::Config constexpr CONFIG = {
+        .thresh_tap = {.thresh_tap = 48U},
+        .dur = {.dur = 16U},
+        .thresh_ff = {.thresh_ff = 7U},
+        .tap_axes = {.tap_z_en = 1U, .tap_y_en = 1U, .tap_x_en = 1U, .suppress = 1U},
+        .bw_rate = {.rate = std::to_underlying(ADXL345::DataRate::RATE_800HZ), .low_power = 0U},
+        .power_ctl = {.wakeup = 0U, .sleep = 0U, .measure = 1U, .auto_sleep = 0U, .link = 0U},
+        .data_format = {.range = std::to_underlying(ADXL345::Range::FS_16G),
+                        .justify = 0U,
+                        .full_res = 1U,
+                        .int_invert = 0U,
+                        .spi = 0U,
+                        .self_test = 0U},
+        .fifo_ctl = {.samples = 0U, .trigger = 0U, .fifo_mode = std::to_underlying(ADXL345::FifoMode::BYPASS)}};
+
+    ADXL345Sim::Waveform constexpr REST_WAVEFORM = {.offset = {0.05F, -0.03F, 1.02F}, .amplitude = {}, .frequency = {}};
+    ADXL345Sim::Waveform constexpr MOVING_WAVEFORM = {.offset = {0.05F, -0.03F, 1.02F},
+                                                      .amplitude = {0.2F, 0.2F, 0.2F},
+                                                      .frequency = {5.0F, 7.0F, 11.0F}};
+    ADXL345Sim::Waveform constexpr TILTED_WAVEFORM = {.offset = {0.5F, 0.0F, 0.87F}, .amplitude = {}, .frequency = {}};
+
+    struct Write {
+        std::uint8_t reg_address{};
+        std::size_t size{};
+    };
+
+    struct WriteLog {
+        std::array<Write, 16UZ> writes{};
+        std::size_t count{};
+    };
+
+    struct RecordingDevice {
+    public:
+        ADXL345Sim::Expected<void> read_bytes(std::uint8_t const reg_address,
+                                              std::span<std::uint8_t> const bytes) const noexcept
+        {
+            return this->device.read_bytes(reg_address, bytes);
+        }
+
+        ADXL345Sim::Expected<std::uint8_t> read_byte(std::uint8_t const reg_address) const noexcept
+        {
+            return this->device.read_byte(reg_address);
+        }
+
+        ADXL345Sim::Expected<void> write_bytes(std::uint8_t const reg_address,
+                                               std::span<std::uint8_t const> const bytes) const noexcept
+        {
+            this->record(reg_address, bytes.size());
+            return this->device.write_bytes(reg_address, bytes);
+        }
+
+        ADXL345Sim::Expected<void> write_byte(std::uint8_t const reg_address, std::uint8_t const byte) const noexcept
+        {
+            this->record(reg_address, 1UZ);
+            return this->device.write_byte(reg_address, byte);
+        }
+
+        ADXL345Sim::I2CDevice device{};
+        WriteLog* write_log{nullptr};
+
+    private:
+        void record(std::uint8_t const reg_address, std::size_t const size) const noexcept
+        {
+            if (this->write_log->count < this->write_log->writes.size()) {
+                this->write_log->writes[this->write_log->count] = Write{.reg_address = reg_address, .size = size};
+            }
+            ++this->write_log->count;
+        }
+    };
+
+    using Sensor = ADXL345::ADXL345<RecordingDevice>;
+
+    using AsyncSensor = ADXL345::ADXL345<ADXL345Sim::I2CDevice, ADXL345Sim::I2CDMADevice>;
+
+    using SPISensor = ADXL345::ADXL345<ADXL345Sim::SPIDevice, ADXL345Sim::SPIDevice>;
+
+    struct DrainResult {
+        std::optional<std::size_t> drained{};
+        std::size_t calls{};
+    };
+
+    void record_drain(void* const context, std::optional<std::size_t> const drained) noexcept
+    {
+        auto* const drain_result = static_cast<DrainResult*>(context);
+        drain_result->drained = drained;
+        ++drain_result->calls;
+    }
+
+    std::uint32_t get_milliseconds(void* const context) noexcept
+    {
+        return static_cast<std::uint32_t>(static_cast<ADXL345Sim::ADXL345Sim*>(context)->get_time() / NS_PER_MS);
+    }
+
+    std::uint8_t constexpr address(ADXL345::RA const reg_address) noexcept
+    {
+        return std::to_underlying(reg_address);
+    }
+
+    bool is_write(WriteLog const& write_log,
+                  std::size_t const index,
+                  ADXL345::RA const reg_address,
+                  std::size_t const size) noexcept
+    {
+        return index < write_log.count && write_log.writes[index].reg_address == address(reg_address) &&
+               write_log.writes[index].size == size;
+    }
+
+    void test_initialize_bursts(UnitTest::UnitTest& unit_test) noexcept
+    {
+        ADXL345Sim::ADXL345Sim simulator{};
+        WriteLog write_log{};
+        Sensor adxl345{RecordingDevice{.device = ADXL345Sim::I2CDevice{&simulator}, .write_log = &write_log}, CONFIG};
+
+        auto const tap_block_size = address(ADXL345::RA::TAP_AXES) - address(ADXL345::RA::THRESH_TAP) + 1UZ;
+        auto const power_block_size = address(ADXL345::RA::INT_MAP) - address(ADXL345::RA::BW_RATE) + 1UZ;
+
+        unit_test.expect(write_log.count == 4UZ);
+        unit_test.expect(is_write(write_log, 0UZ, ADXL345::RA::THRESH_TAP, tap_block_size));
+        unit_test.expect(is_write(write_log, 1UZ, ADXL345::RA::DATA_FORMAT, 1UZ));
+        unit_test.expect(is_write(write_log, 2UZ, ADXL345::RA::FIFO_CTL, 1UZ));
+        unit_test.expect(is_write(write_log, 3UZ, ADXL345::RA::BW_RATE, power_block_size));
+        unit_test.expect(adxl345.verify_registers());
+        unit_test.expect(adxl345.get_data_rate() == ADXL345::DataRate::RATE_800HZ);
+    }
+
+    void test_write_skip_cache(UnitTest::UnitTest& unit_test) noexcept
+    {
+        ADXL345Sim::ADXL345Sim simulator{};
+        WriteLog write_log{};
+        Sensor adxl345{RecordingDevice{.device = ADXL345Sim::I2CDevice{&simulator}, .write_log = &write_log}, CONFIG};
+
+        write_log = WriteLog{};
+        simulator.clear_bus_statistics();
+        unit_test.expect(adxl345.set_data_rate(ADXL345::DataRate::RATE_800HZ));
+        unit_test.expect(write_log.count == 0UZ);
+        unit_test.expect(simulator.get_bus_statistics().transactions == 0U);
+
+        unit_test.expect(adxl345.set_data_rate(ADXL345::DataRate::RATE_1600HZ));
+        unit_test.expect(write_log.count == 1UZ);
+        unit_test.expect(is_write(write_log, 0UZ, ADXL345::RA::BW_RATE, 1UZ));
+
+        unit_test.expect(adxl345.set_data_rate(ADXL345::DataRate::RATE_1600HZ));
+        unit_test.expect(write_log.count == 1UZ);
+        unit_test.expect(adxl345.verify_registers());
+    }
+
+    void test_fifo_drain_counts(UnitTest::UnitTest& unit_test) noexcept
+    {
+        ADXL345Sim::ADXL345Sim simulator{};
+        WriteLog write_log{};
+        Sensor adxl345{RecordingDevice{.device = ADXL345Sim::I2CDevice{&simulator}, .write_log = &write_log}, CONFIG};
+        unit_test.expect(
+            adxl345.start_fifo_streaming(ADXL345::FifoMode::STREAM, WATERMARK, ADXL345::InterruptPin::INT1));
+
+        std::array<ADXL345::Vec3D<std::int16_t>, ADXL345::FIFO_SIZE> samples{};
+
+        simulator.advance_samples(10UZ);
+        unit_test.expect(adxl345.get_fifo_entries() == 10UZ);
+        unit_test.expect(adxl345.drain_fifo_raw(samples) == 10UZ);
+        unit_test.expect(simulator.get_fifo_entries() == 0UZ);
+
+        simulator.advance_samples(20UZ);
+        unit_test.expect(adxl345.drain_fifo_raw(std::span{samples}.first(8UZ)) == 8UZ);
+        unit_test.expect(simulator.get_fifo_entries() == 12UZ);
+
+        ADXL345::SampleBlock<std::int16_t, ADXL345::FIFO_SIZE> block{};
+        unit_test.expect(adxl345.drain_fifo_block(block) == 12UZ);
+        unit_test.expect(block.size() == 12UZ);
+        unit_test.expect(simulator.get_fifo_entries() == 0UZ);
+
+        simulator.advance_samples(STALL_SAMPLES);
+        unit_test.expect(simulator.get_fifo_entries() == ADXL345::FIFO_SIZE);
+        unit_test.expect(adxl345.drain_fifo_raw(samples) == ADXL345::FIFO_SIZE);
+        unit_test.expect(adxl345.drain_fifo_raw(samples) == 0UZ);
+
+        unit_test.expect(adxl345.stop_fifo_streaming());
+    }
+
+    void test_async_fifo_drain(UnitTest::UnitTest& unit_test) noexcept
+    {
+        ADXL345Sim::ADXL345Sim simulator{};
+        simulator.set_waveform(REST_WAVEFORM);
+
+        AsyncSensor adxl345{ADXL345Sim::I2CDevice{&simulator}, ADXL345Sim::I2CDMADevice{&simulator}, CONFIG};
+        unit_test.expect(
+            adxl345.start_fifo_streaming(ADXL345::FifoMode::STREAM, WATERMARK, ADXL345::InterruptPin::INT1));
+
+        ADXL345::SampleBlock<std::int16_t, ADXL345::FIFO_SIZE> block{};
+        DrainResult drain_result{};
+
+        simulator.advance_samples(20UZ);
+        unit_test.expect(adxl345.drain_fifo_block_async(block, &record_drain, &drain_result));
+        unit_test.expect(drain_result.calls == 1UZ && drain_result.drained == 20UZ);
+        unit_test.expect(block.size() == 20UZ && simulator.get_fifo_entries() == 0UZ);
+        unit_test.expect(!adxl345.is_draining());
+
+        auto const sample = block.get_sample(19UZ);
+        unit_test.expect(sample.x == 13 && sample.y == -8 && sample.z == 261);
+
+        ADXL345::SampleBlock<std::int16_t, 8UZ> small_block{};
+        simulator.advance_samples(12UZ);
+        unit_test.expect(adxl345.drain_fifo_block_async(small_block, &record_drain, &drain_result));
+        unit_test.expect(drain_result.calls == 2UZ && drain_result.drained == 8UZ);
+        unit_test.expect(simulator.get_fifo_entries() == 4UZ);
+
+        block.clear();
+        simulator.inject_bus_errors(ADXL345Sim::BusError::NACK, ADXL345::DEFAULT_MAX_RETRIES + 1UZ);
+        unit_test.expect(adxl345.drain_fifo_block_async(block, &record_drain, &drain_result));
+        unit_test.expect(drain_result.calls == 3UZ && !drain_result.drained.has_value());
+        unit_test.expect(simulator.get_fifo_entries() == 4UZ);
+
+        simulator.inject_bus_errors(ADXL345Sim::BusError::NACK, 1UZ);
+        unit_test.expect(adxl345.drain_fifo_block_async(block, &record_drain, &drain_result));
+        unit_test.expect(drain_result.calls == 4UZ && drain_result.drained == 4UZ);
+        unit_test.expect(simulator.get_fifo_entries() == 0UZ);
+    }
+
+    void test_spi_fifo_timing(UnitTest::UnitTest& unit_test) noexcept
+    {
+        ADXL345Sim::ADXL345Sim simulator{};
+        simulator.set_waveform(REST_WAVEFORM);
+        simulator.set_bus_protocol(ADXL345Sim::BusProtocol::SPI);
+        simulator.set_bus_clock(SPI_BUS_CLOCK_HZ);
+
+        {
+            SPISensor adxl345{ADXL345Sim::SPIDevice{&simulator}, ADXL345Sim::SPIDevice{&simulator}, CONFIG};
+            unit_test.expect(
+                adxl345.start_fifo_streaming(ADXL345::FifoMode::STREAM, WATERMARK, ADXL345::InterruptPin::INT1));
+
+            ADXL345::SampleBlock<std::int16_t, ADXL345::FIFO_SIZE> block{};
+            simulator.advance_samples(20UZ);
+            simulator.clear_bus_statistics();
+            unit_test.expect(adxl345.drain_fifo_block(block) == 20UZ);
+            unit_test.expect(simulator.get_fifo_entries() == 0UZ);
+            unit_test.expect(simulator.get_bus_statistics().fifo_timing_violations == 0ULL);
+
+            auto const sample = block.get_sample(19UZ);
+            unit_test.expect(sample.x == 13 && sample.y == -8 && sample.z == 261);
+
+            block.clear();
+            DrainResult drain_result{};
+            simulator.advance_samples(20UZ);
+            unit_test.expect(adxl345.drain_fifo_block_async(block, &record_drain, &drain_result));
+            unit_test.expect(drain_result.calls == 1UZ && drain_result.drained == 20UZ);
+            unit_test.expect(simulator.get_fifo_entries() == 0UZ);
+            unit_test.expect(simulator.get_bus_statistics().fifo_timing_violations == 0ULL);
+
+            simulator.advance_samples(5UZ);
+            simulator.clear_bus_statistics();
+
+            std::array<std::uint8_t, sizeof(ADXL345::FIFO_DATA)> bytes{};
+            unit_test.expect(simulator.read(ADXL345::REG_ADDRESS<ADXL345::FIFO_DATA>, bytes).has_value());
+            unit_test.expect(std::bit_cast<ADXL345::FIFO_DATA>(bytes).fifo_status.entries == 5U);
+            unit_test.expect(simulator.get_bus_statistics().fifo_timing_violations == 1ULL);
+            unit_test.expect(simulator.get_fifo_entries() == 4UZ);
+        }
+
+        {
+            ADXL345::ADXL345<ADXL345Sim::SPIDevice> adxl345{ADXL345Sim::SPIDevice{&simulator, 0ULL}, CONFIG};
+            unit_test.expect(
+                adxl345.start_fifo_streaming(ADXL345::FifoMode::STREAM, WATERMARK, ADXL345::InterruptPin::INT1));
+
+            ADXL345::SampleBlock<std::int16_t, ADXL345::FIFO_SIZE> block{};
+            simulator.advance_samples(20UZ);
+            simulator.clear_bus_statistics();
+            adxl345.drain_fifo_block(block);
+            unit_test.expect(simulator.get_bus_statistics().fifo_timing_violations > 0ULL);
+        }
+    }
+
+    void test_overrun_accounting(UnitTest::UnitTest& unit_test) noexcept
+    {
+        ADXL345Sim::ADXL345Sim simulator{};
+        WriteLog write_log{};
+        Sensor adxl345{RecordingDevice{.device = ADXL345Sim::I2CDevice{&simulator}, .write_log = &write_log}, CONFIG};
+        unit_test.expect(
+            adxl345.start_fifo_streaming(ADXL345::FifoMode::STREAM, WATERMARK, ADXL345::InterruptPin::INT1));
+
+        auto const to_ticks = [&simulator] {
+            return static_cast<std::uint32_t>(simulator.get_time() * TICK_FREQUENCY / NS_PER_S);
+        };
+
+        TimestampReconstructor::TimestampReconstructor timestamp_reconstructor{
+            TICK_FREQUENCY,
+            ADXL345::data_rate_to_frequency(ADXL345::DataRate::RATE_800HZ)};
+        std::array<std::uint32_t, ADXL345::FIFO_SIZE> timestamps{};
+        std::array<ADXL345::Vec3D<std::int16_t>, ADXL345::FIFO_SIZE> samples{};
+
+        for (auto burst = 0UZ; burst < 4UZ; ++burst) {
+            simulator.advance_samples(WATERMARK);
+            auto const int_source = adxl345.get_interrupt_source();
+            unit_test.expect(int_source.has_value() && int_source->watermark == 1U && int_source->overrun == 0U);
+
+            timestamp_reconstructor.capture(to_ticks(), WATERMARK);
+            auto const drained = adxl345.drain_fifo_raw(samples).value_or(0UZ);
+            unit_test.expect(timestamp_reconstructor.reconstruct(std::span{timestamps}.first(drained)));
+        }
+
+        auto const lost_before = simulator.get_lost_samples();
+        simulator.advance_samples(STALL_SAMPLES);
+
+        auto const int_source = adxl345.get_interrupt_source();
+        unit_test.expect(int_source.has_value() && int_source->overrun == 1U);
+
+        auto const entries = adxl345.get_fifo_entries().value_or(0UZ);
+        unit_test.expect(entries == ADXL345::FIFO_SIZE);
+
+        auto const lost = timestamp_reconstructor.recover(to_ticks(), entries);
+        unit_test.expect(lost == simulator.get_lost_samples() - lost_before);
+        unit_test.expect(lost == STALL_SAMPLES - ADXL345::FIFO_SIZE);
+
+        auto const drained = adxl345.drain_fifo_raw(samples).value_or(0UZ);
+        unit_test.expect(drained == entries);
+        unit_test.expect(timestamp_reconstructor.reconstruct(std::span{timestamps}.first(drained)));
+
+        auto const cleared = adxl345.get_interrupt_source();
+        unit_test.expect(cleared.has_value() && cleared->overrun == 0U);
+    }
+
+    void test_offset_calibration(UnitTest::UnitTest& unit_test) noexcept
+    {
+        ADXL345Sim::ADXL345Sim simulator{};
+        simulator.set_waveform(REST_WAVEFORM);
+        simulator.set_bus_clock(I2C_BUS_CLOCK_HZ);
+
+        WriteLog write_log{};
+        Sensor adxl345{RecordingDevice{.device = ADXL345Sim::I2CDevice{&simulator}, .write_log = &write_log}, CONFIG};
+
+        auto const offsets =
+            adxl345.calibrate_offsets(CALIBRATION_SAMPLES, CALIBRATION_EXPECTED_MILLI_G, get_milliseconds, &simulator);
+        if (!unit_test.expect(offsets.has_value())) {
+            return;
+        }
+        auto const stored = adxl345.get_offsets();
+        unit_test.expect(stored.has_value() && stored->x == offsets->x && stored->y == offsets->y &&
+                         stored->z == offsets->z);
+        unit_test.expect(offsets->x < 0 && offsets->y > 0 && offsets->z < 0);
+
+        simulator.advance_samples(1UZ);
+        auto const residual = adxl345.get_acceleration_milli_g();
+        if (!unit_test.expect(residual.has_value())) {
+            return;
+        }
+        unit_test.expect(std::abs(residual->x - CALIBRATION_EXPECTED_MILLI_G.x) <= CALIBRATION_TOLERANCE_MILLI_G);
+        unit_test.expect(std::abs(residual->y - CALIBRATION_EXPECTED_MILLI_G.y) <= CALIBRATION_TOLERANCE_MILLI_G);
+        unit_test.expect(std::abs(residual->z - CALIBRATION_EXPECTED_MILLI_G.z) <= CALIBRATION_TOLERANCE_MILLI_G);
+        unit_test.expect(adxl345.verify_registers());
+    }
+
+    void test_calibration_rejection(UnitTest::UnitTest& unit_test) noexcept
+    {
+        ADXL345Sim::ADXL345Sim simulator{};
+        simulator.set_bus_clock(I2C_BUS_CLOCK_HZ);
+
+        WriteLog write_log{};
+        Sensor adxl345{RecordingDevice{.device = ADXL345Sim::I2CDevice{&simulator}, .write_log = &write_log}, CONFIG};
+        unit_test.expect(adxl345.set_offsets(PREVIOUS_OFFSETS));
+
+        auto const expect_rejected = [&](std::uint32_t const timeout_ms) {
+            auto const offsets = adxl345.calibrate_offsets(CALIBRATION_SAMPLES,
+                                                           CALIBRATION_EXPECTED_MILLI_G,
+                                                           get_milliseconds,
+                                                           &simulator,
+                                                           timeout_ms);
+            unit_test.expect(!offsets.has_value());
+
+            auto const stored = adxl345.get_offsets();
+            unit_test.expect(stored.has_value() && stored->x == PREVIOUS_OFFSETS.x &&
+                             stored->y == PREVIOUS_OFFSETS.y && stored->z == PREVIOUS_OFFSETS.z);
+        };
+
+        simulator.set_waveform(MOVING_WAVEFORM);
+        expect_rejected(ADXL345::CALIBRATION_TIMEOUT_MS);
+
+        simulator.set_waveform(TILTED_WAVEFORM);
+        expect_rejected(ADXL345::CALIBRATION_TIMEOUT_MS);
+
+        simulator.set_waveform(REST_WAVEFORM);
+        expect_rejected(CALIBRATION_SHORT_TIMEOUT_MS);
+
+        unit_test.expect(
+            adxl345.calibrate_offsets(CALIBRATION_SAMPLES, CALIBRATION_EXPECTED_MILLI_G, get_milliseconds, &simulator)
+                .has_value());
+        unit_test.expect(adxl345.verify_registers());
+    }
+
+}; // namespace
+
+int main()
+{
+    UnitTest::UnitTest unit_test{"adxl345_tests"};
+
+    unit_test.run("initialize bursts", test_initialize_bursts);
+    unit_test.run("write-skip cache", test_write_skip_cache);
+    unit_test.run("fifo drain counts", test_fifo_drain_counts);
+    unit_test.run("async fifo drain", test_async_fifo_drain);
+    unit_test.run("spi fifo timing", test_spi_fifo_timing);
+    unit_test.run("overrun accounting", test_overrun_accounting);
+    unit_test.run("offset calibration", test_offset_calibration);
+    unit_test.run("calibration rejection", test_calibration_rejection);
+
+    return unit_test.report();
+}
@@ -0,0 +1,24 @@
+#ifndef BUS_ERROR_HPP
+#define BUS_ERROR_HPP
+
+#include <cstdint>
+#include <expected>
+
+namespace BusError {
+
+    enum struct BusError : std::uint8_t {
+        NACK,
+        ARBITRATION_LOST,
+        TIMEOUT,
+        BUSY,
+        BUS_FAULT,
+    };
+
+    template <typename T>
+    using Expected = std::expected<T, BusError>;
+
+    using Unexpected = std::unexpected<BusError>;
+
+}; // namespace BusError
+
+#endif // BUS_ERROR_HPP
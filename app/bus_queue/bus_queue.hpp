@@ -0,0 +1,174 @@
+#ifndef BUS_QUEUE_HPP
+#define BUS_QUEUE_HPP
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <utility>
+
+namespace BusQueue {
+
+    template <typename T, typename Priority>
+    struct Entry {
+        T element{};
+        Priority priority{};
+    };
+
+    template <typename T, typename Priority, std::size_t SIZE>
+    struct BusQueue {
+    public:
+        BusQueue() noexcept = default;
+        explicit BusQueue(std::uint32_t const sequence) noexcept;
+
+        BusQueue(BusQueue const& other) noexcept = default;
+        BusQueue(BusQueue&& other) noexcept = default;
+
+        BusQueue& operator=(BusQueue const& other) noexcept = default;
+        BusQueue& operator=(BusQueue&& other) noexcept = default;
+
+        ~BusQueue() noexcept = default;
+
+        bool push(T const& element, Priority const priority) noexcept;
+
+        std::optional<Entry<T, Priority>> pop() noexcept;
+
+        template <std::predicate<T const&, Priority> Predicate>
+        bool contains(Predicate&& predicate) const noexcept;
+
+        template <std::predicate<T const&> Predicate>
+        bool erase(Predicate&& predicate) noexcept;
+
+        bool is_empty() const noexcept;
+        bool is_full() const noexcept;
+
+        std::size_t size() const noexcept;
+
+        static constexpr std::size_t capacity() noexcept
+        {
+            return SIZE;
+        }
+
+    private:
+        struct Slot {
+            T element{};
+            Priority priority{};
+            std::uint32_t sequence{};
+            bool pending{false};
+        };
+
+        Slot* get_next_slot() noexcept;
+
+        std::array<Slot, SIZE> slots_{};
+        std::uint32_t sequence_{};
+    };
+
+    template <typename T, typename Priority, std::size_t SIZE>
+    inline BusQueue<T, Priority, SIZE>::BusQueue(std::uint32_t const sequence) noexcept : sequence_{sequence}
+    {}
+
+    template <typename T, typename Priority, std::size_t SIZE>
+    inline bool BusQueue<T, Priority, SIZE>::push(T const& element, Priority const priority) noexcept
+    {
+        auto const free_slot =
+            std::find_if(this->slots_.begin(), this->slots_.end(), [](Slot const& slot) { return !slot.pending; });
+        if (free_slot == this->slots_.end()) {
+            return false;
+        }
+
+        *free_slot = Slot{.element = element, .priority = priority, .sequence = this->sequence_++, .pending = true};
+        return true;
+    }
+
+    template <typename T, typename Priority, std::size_t SIZE>
+    inline std::optional<Entry<T, Priority>> BusQueue<T, Priority, SIZE>::pop() noexcept
+    {
+        auto* const slot = this->get_next_slot();
+        if (slot == nullptr) {
+            return std::nullopt;
+        }
+
+        slot->pending = false;
+        return Entry<T, Priority>{.element = slot->element, .priority = slot->priority};
+    }
+
+    template <typename T, typename Priority, std::size_t SIZE>
+    template <std::predicate<T const&, Priority> Predicate>
+    inline bool BusQueue<T, Priority, SIZE>::contains(Predicate&& predicate) const noexcept
+    {
+        return std::any_of(this->slots_.begin(), this->slots_.end(), [&predicate](Slot const& slot) {
+            return slot.pending && std::invoke(predicate, slot.element, slot.priority);
+        });
+    }
+
+    template <typename T, typename Priority, std::size_t SIZE>
+    template <std::predicate<T const&> Predicate>
+    inline bool BusQueue<T, Priority, SIZE>::erase(Predicate&& predicate) noexcept
+    {
+        auto const pending_slot =
+            std::find_if(this->slots_.begin(), this->slots_.end(), [&predicate](Slot const& slot) {
+                return slot.pending && std::invoke(predicate, slot.element);
+            });
+        if (pending_slot == this->slots_.end()) {
+            return false;
+        }
+
+        pending_slot->pending = false;
+        return true;
+    }
+
+    template <typename T, typename Priority, std::size_t SIZE>
+    inline bool BusQueue<T, Priority, SIZE>::is_empty() const noexcept
+    {
+        return this->size() == 0UZ;
+    }
+
+    template <typename T, typename Priority, std::size_t SIZE>
+    inline bool BusQueue<T, Priority, SIZE>::is_full() const noexcept
+    {
+        return this->size() == SIZE;
+    }
+
+    template <typename T, typename Priority, std::size_t SIZE>
+    inline std::size_t BusQueue<T, Priority, SIZE>::size() const noexcept
+    {
+        return static_cast<std::size_t>(
+            std::count_if(this->slots_.begin(), this->slots_.end(), [](Slot const& slot) { return slot.pending; }));
+    }
+
+    template <typename T, typename Priority, std::size_t SIZE>
+    inline typename BusQueue<T, Priority, SIZE>::Slot* BusQueue<T, Priority, SIZE>::get_next_slot() noexcept
+    {
+        Slot* next = nullptr;
+        for (auto& slot : this->slots_) {
+            if (!slot.pending) {
+                continue;
+            }
+            if (next == nullptr || std::to_underlying(slot.priority) < std::to_underlying(next->priority) ||
+                (slot.priority == next->priority &&
+                 static_cast<std::int32_t>(slot.sequence - next->sequence) < 0)) {
+                next = &slot;
+            }
+        }
+        return next;
+    }
+
+    inline float get_utilization(std::uint64_t const busy_ticks,
+                                 std::uint32_t const elapsed_ms,
+                                 std::uint32_t const tick_frequency) noexcept
+    {
+        if (elapsed_ms == 0U || tick_frequency == 0U) {
+            return 0.0F;
+        }
+
+        auto const elapsed_ticks = static_cast<double>(elapsed_ms) * static_cast<double>(tick_frequency) / 1000.0;
+
+        return static_cast<float>(static_cast<double>(busy_ticks) / elapsed_ticks);
+    }
+
+}; // namespace BusQueue
+
+#endif // BUS_QUEUE_HPP
@@ -0,0 +1,120 @@
+#include "bus_queue.hpp"
+#include "unit_test.hpp"
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace {
+
+    std::size_t constexpr SIZE = 4UZ;
+
+    enum struct Priority : std::uint8_t {
+        DATA,
+        CONFIG,
+    };
+
+    using Queue = BusQueue::BusQueue<int, Priority, SIZE>;
+
+    template <std::size_t COUNT>
+    bool pops_in_order(Queue& queue, std::array<int, COUNT> const& expected) noexcept
+    {
+        for (auto const element : expected) {
+            auto const entry = queue.pop();
+            if (!entry.has_value() || entry->element != element) {
+                return false;
+            }
+        }
+        return queue.is_empty() && !queue.pop().has_value();
+    }
+
+    void test_priority_order(UnitTest::UnitTest& unit_test) noexcept
+    {
+        Queue queue{};
+        unit_test.expect(queue.push(1, Priority::CONFIG));
+        unit_test.expect(queue.push(2, Priority::DATA));
+        unit_test.expect(queue.push(3, Priority::CONFIG));
+        unit_test.expect(queue.push(4, Priority::DATA));
+
+        auto const entry = queue.pop();
+        unit_test.expect(entry.has_value() && entry->element == 2 && entry->priority == Priority::DATA);
+        unit_test.expect(pops_in_order(queue, std::array{4, 1, 3}));
+    }
+
+    void test_fifo_within_priority(UnitTest::UnitTest& unit_test) noexcept
+    {
+        Queue queue{};
+        unit_test.expect(queue.push(1, Priority::DATA));
+        unit_test.expect(queue.push(2, Priority::DATA));
+        unit_test.expect(queue.pop()->element == 1);
+
+        unit_test.expect(queue.push(3, Priority::DATA));
+        unit_test.expect(queue.push(4, Priority::DATA));
+        unit_test.expect(pops_in_order(queue, std::array{2, 3, 4}));
+    }
+
+    void test_sequence_wraparound(UnitTest::UnitTest& unit_test) noexcept
+    {
+        Queue queue{0xFFFF'FFFEU};
+        for (auto const element : {1, 2, 3, 4}) {
+            unit_test.expect(queue.push(element, Priority::CONFIG));
+        }
+        unit_test.expect(pops_in_order(queue, std::array{1, 2, 3, 4}));
+    }
+
+    void test_full(UnitTest::UnitTest& unit_test) noexcept
+    {
+        Queue queue{};
+        for (auto element = 0; element < static_cast<int>(SIZE); ++element) {
+            unit_test.expect(queue.push(element, Priority::CONFIG));
+        }
+        unit_test.expect(queue.is_full() && queue.size() == SIZE);
+        unit_test.expect(!queue.push(99, Priority::DATA));
+
+        queue.pop();
+        unit_test.expect(queue.push(99, Priority::DATA));
+        unit_test.expect(queue.pop()->element == 99);
+    }
+
+    void test_cancel(UnitTest::UnitTest& unit_test) noexcept
+    {
+        Queue queue{};
+        unit_test.expect(queue.push(1, Priority::DATA));
+        unit_test.expect(queue.push(2, Priority::CONFIG));
+        unit_test.expect(queue.push(2, Priority::DATA));
+
+        auto const is_two = [](int const element) { return element == 2; };
+        unit_test.expect(queue.contains([](int const element, Priority const priority) {
+            return element == 2 && priority == Priority::CONFIG;
+        }));
+        unit_test.expect(queue.erase(is_two));
+        unit_test.expect(queue.size() == 2UZ);
+        unit_test.expect(queue.erase(is_two));
+        unit_test.expect(!queue.erase(is_two));
+        unit_test.expect(!queue.contains([](int const element, Priority const) { return element == 2; }));
+        unit_test.expect(pops_in_order(queue, std::array{1}));
+    }
+
+    void test_utilization(UnitTest::UnitTest& unit_test) noexcept
+    {
+        unit_test.expect(BusQueue::get_utilization(40'000'000U, 1'000U, 80'000'000U) == 0.5F);
+        unit_test.expect(std::abs(BusQueue::get_utilization(8'192U, 1'000U, 32'768U) - 0.25F) < 1.0E-6F);
+        unit_test.expect(BusQueue::get_utilization(1'000U, 0U, 80'000'000U) == 0.0F);
+        unit_test.expect(BusQueue::get_utilization(1'000U, 10U, 0U) == 0.0F);
+    }
+
+}; // namespace
+
+int main()
+{
+    UnitTest::UnitTest unit_test{"bus_queue_tests"};
+
+    unit_test.run("priority order", test_priority_order);
+    unit_test.run("fifo within priority", test_fifo_within_priority);
+    unit_test.run("sequence wraparound", test_sequence_wraparound);
+    unit_test.run("full", test_full);
+    unit_test.run("cancel", test_cancel);
+    unit_test.run("utilization", test_utilization);
+
+    return unit_test.report();
+}
@@ -0,0 +1,105 @@
+#include "calibration_storage.hpp"
+#include "stm32l4xx_hal.h"
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+
+extern "C" {
+
+    extern std::uint8_t _scalibration[];
+}
+
+namespace CalibrationStorage {
+
+    namespace {
+
+        std::uint32_t constexpr CRC_POLYNOMIAL = 0xEDB88320U;
+
+        std::uint32_t get_address() noexcept
+        {
+            return static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(_scalibration));
+        }
+
+        std::span<std::uint8_t const> get_record_bytes(Record const& record) noexcept
+        {
+            return std::span{reinterpret_cast<std::uint8_t const*>(&record), offsetof(Record, crc)};
+        }
+
+    }; // namespace
+
+    std::optional<Vec3D<std::int8_t>> load_offsets() noexcept
+    {
+        Record record{};
+        std::memcpy(&record, _scalibration, sizeof(Record));
+
+        if (record.magic != MAGIC || record.version != VERSION ||
+            record.crc != calculate_crc(get_record_bytes(record))) {
+            return std::nullopt;
+        }
+
+        return Vec3D<std::int8_t>{record.offset_x, record.offset_y, record.offset_z};
+    }
+
+    bool store_offsets(Vec3D<std::int8_t> const& offsets) noexcept
+    {
+        auto record = Record{.magic = MAGIC,
+                             .offset_x = offsets.x,
+                             .offset_y = offsets.y,
+                             .offset_z = offsets.z,
+                             .version = VERSION,
+                             .crc = 0U,
+                             .reserved = 0xFFFFFFFFU};
+        record.crc = calculate_crc(get_record_bytes(record));
+
+        if (!erase_offsets()) {
+            return false;
+        }
+
+        auto const double_words =
+            std::bit_cast<std::array<std::uint64_t, sizeof(Record) / sizeof(std::uint64_t)>>(record);
+
+        HAL_FLASH_Unlock();
+        auto status = HAL_OK;
+        for (auto index = 0UZ; index < double_words.size() && status == HAL_OK; ++index) {
+            status = HAL_FLASH_Program(FLASH_TYPEPROGRAM_DOUBLEWORD,
+                                       get_address() + static_cast<std::uint32_t>(index * sizeof(std::uint64_t)),
+                                       double_words[index]);
+        }
+        HAL_FLASH_Lock();
+
+        return status == HAL_OK && load_offsets().has_value();
+    }
+
+    bool erase_offsets() noexcept
+    {
+        auto const offset = get_address() - FLASH_BASE;
+        auto const page = static_cast<std::uint32_t>((offset % FLASH_BANK_SIZE) / FLASH_PAGE_SIZE);
+
+        auto erase = FLASH_EraseInitTypeDef{.TypeErase = FLASH_TYPEERASE_PAGES,
+                                            .Banks = offset < FLASH_BANK_SIZE ? FLASH_BANK_1 : FLASH_BANK_2,
+                                            .Page = page,
+                                            .NbPages = 1U};
+        auto page_error = std::uint32_t{};
+
+        HAL_FLASH_Unlock();
+        __HAL_FLASH_CLEAR_FLAG(FLASH_FLAG_ALL_ERRORS);
+        auto const status = HAL_FLASHEx_Erase(&erase, &page_error);
+        HAL_FLASH_Lock();
+
+        return status == HAL_OK;
+    }
+
+    std::uint32_t calculate_crc(std::span<std::uint8_t const> const bytes) noexcept
+    {
+        auto crc = 0xFFFFFFFFU;
+        for (auto const byte : bytes) {
+            crc ^= byte;
+            for (auto bit = 0U; bit < 8U; ++bit) {
+                crc = (crc >> 1U) ^ ((crc & 1U) != 0U ? CRC_POLYNOMIAL : 0U);
+            }
+        }
+        return ~crc;
+    }
+
+}; // namespace CalibrationStorage
@@ -0,0 +1,40 @@
+#ifndef CALIBRATION_STORAGE_HPP
+#define CALIBRATION_STORAGE_HPP
+
+#include "vector3d.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+
+namespace CalibrationStorage {
+
+    template <typename T>
+    using Vec3D = Utility::Vector3D<T>;
+
+    std::uint32_t constexpr MAGIC = 0x4C435841U;
+    std::uint8_t constexpr VERSION = 1U;
+
+    struct Record {
+        std::uint32_t magic{};
+        std::int8_t offset_x{};
+        std::int8_t offset_y{};
+        std::int8_t offset_z{};
+        std::uint8_t version{};
+        std::uint32_t crc{};
+        std::uint32_t reserved{};
+    };
+
+    static_assert(sizeof(Record) % sizeof(std::uint64_t) == 0UZ);
+
+    std::optional<Vec3D<std::int8_t>> load_offsets() noexcept;
+
+    bool store_offsets(Vec3D<std::int8_t> const& offsets) noexcept;
+
+    bool erase_offsets() noexcept;
+
+    std::uint32_t calculate_crc(std::span<std::uint8_t const> const bytes) noexcept;
+
+}; // namespace CalibrationStorage
+
+#endif // CALIBRATION_STORAGE_HPP
@@ -0,0 +1,115 @@
+#include "event_dispatcher.hpp"
+#include <bit>
+
+namespace EventDispatcher {
+
+    namespace {
+
+        std::array<EventType, 5UZ> constexpr EVENT_ORDER = {EventType::FREE_FALL,
+                                                           EventType::INACTIVITY,
+                                                           EventType::ACTIVITY,
+                                                           EventType::SINGLE_TAP,
+                                                           EventType::DOUBLE_TAP};
+
+        Axes get_axes(EventType const event_type, ADXL345::ACT_TAP_STATUS const& act_tap_status) noexcept
+        {
+            switch (event_type) {
+                case EventType::ACTIVITY:
+                    return Axes{.x = act_tap_status.act_x_src == 1U,
+                                .y = act_tap_status.act_y_src == 1U,
+                                .z = act_tap_status.act_z_src == 1U};
+                case EventType::SINGLE_TAP:
+                case EventType::DOUBLE_TAP:
+                    return Axes{.x = act_tap_status.tap_x_src == 1U,
+                                .y = act_tap_status.tap_y_src == 1U,
+                                .z = act_tap_status.tap_z_src == 1U};
+                default:
+                    return Axes{};
+            }
+        }
+
+    }; // namespace
+
+    bool needs_act_tap_status(ADXL345::INT_SOURCE const int_source) noexcept
+    {
+        return int_source.single_tap == 1U || int_source.double_tap == 1U || int_source.activity == 1U;
+    }
+
+    ADXL345::INT_ENABLE enable_events(ADXL345::INT_ENABLE const int_enable, EventMask const event_mask) noexcept
+    {
+        return std::bit_cast<ADXL345::INT_ENABLE>(
+            static_cast<std::uint8_t>(std::bit_cast<std::uint8_t>(int_enable) | (event_mask & ALL_EVENTS)));
+    }
+
+    bool EventDispatcher::register_handler(EventMask const event_mask,
+                                           EventHandler const handler,
+                                           void* const context) noexcept
+    {
+        if (handler == nullptr || (event_mask & ALL_EVENTS) == 0U ||
+            this->registration_count_ == this->registrations_.size()) {
+            return false;
+        }
+
+        this->registrations_[this->registration_count_++] =
+            Registration{.event_mask = static_cast<EventMask>(event_mask & ALL_EVENTS),
+                         .handler = handler,
+                         .context = context};
+        this->event_mask_ = static_cast<EventMask>(this->event_mask_ | event_mask);
+        return true;
+    }
+
+    std::size_t EventDispatcher::decode(ADXL345::INT_SOURCE const int_source,
+                                        std::optional<ADXL345::ACT_TAP_STATUS> const& act_tap_status,
+                                        std::uint32_t const timestamp) noexcept
+    {
+        auto const pending = static_cast<EventMask>(std::bit_cast<std::uint8_t>(int_source) & this->event_mask_);
+
+        auto decoded = 0UZ;
+        for (auto const event_type : EVENT_ORDER) {
+            if ((pending & to_event_mask(event_type)) == 0U) {
+                continue;
+            }
+
+            auto const event =
+                Event{.type = event_type,
+                      .axes = act_tap_status.has_value() ? get_axes(event_type, *act_tap_status) : Axes{},
+                      .asleep = act_tap_status.has_value() && act_tap_status->asleep == 1U,
+                      .timestamp = timestamp};
+            if (this->events_.push(event)) {
+                ++decoded;
+            } else {
+                ++this->dropped_events_;
+            }
+        }
+
+        return decoded;
+    }
+
+    std::size_t EventDispatcher::dispatch() noexcept
+    {
+        auto dispatched = 0UZ;
+        while (auto const event = this->events_.pop()) {
+            auto const event_mask = to_event_mask(event->type);
+            for (auto index = 0UZ; index < this->registration_count_; ++index) {
+                auto const& registration = this->registrations_[index];
+                if ((registration.event_mask & event_mask) != 0U) {
+                    registration.handler(registration.context, *event);
+                }
+            }
+            ++dispatched;
+        }
+
+        return dispatched;
+    }
+
+    EventMask EventDispatcher::get_event_mask() const noexcept
+    {
+        return this->event_mask_;
+    }
+
+    std::uint32_t EventDispatcher::get_dropped_events() const noexcept
+    {
+        return this->dropped_events_;
+    }
+
+}; // namespace EventDispatcher
@@ -0,0 +1,98 @@
+#ifndef EVENT_DISPATCHER_HPP
+#define EVENT_DISPATCHER_HPP
+
+#include "adxl345_registers.hpp"
+#include "ring_buffer.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+
+namespace EventDispatcher {
+
+    enum struct EventType : std::uint8_t {
+        FREE_FALL = 2U,
+        INACTIVITY = 3U,
+        ACTIVITY = 4U,
+        DOUBLE_TAP = 5U,
+        SINGLE_TAP = 6U,
+    };
+
+    using EventMask = std::uint8_t;
+
+    constexpr EventMask to_event_mask(EventType const event_type) noexcept
+    {
+        return static_cast<EventMask>(1U << std::to_underlying(event_type));
+    }
+
+    EventMask constexpr ALL_EVENTS = to_event_mask(EventType::FREE_FALL) | to_event_mask(EventType::INACTIVITY) |
+                                     to_event_mask(EventType::ACTIVITY) | to_event_mask(EventType::DOUBLE_TAP) |
+                                     to_event_mask(EventType::SINGLE_TAP);
+
+    struct Axes {
+        bool x{};
+        bool y{};
+        bool z{};
+    };
+
+    struct Event {
+        EventType type{};
+        Axes axes{};
+        bool asleep{};
+        std::uint32_t timestamp{};
+    };
+
+    using EventHandler = void (*)(void* const context, Event const& event) noexcept;
+
+    std::size_t constexpr MAX_HANDLERS = 8UZ;
+    std::size_t constexpr QUEUE_SIZE = 16UZ;
+
+    bool needs_act_tap_status(ADXL345::INT_SOURCE const int_source) noexcept;
+
+    ADXL345::INT_ENABLE enable_events(ADXL345::INT_ENABLE const int_enable, EventMask const event_mask) noexcept;
+
+    struct EventDispatcher {
+    public:
+        EventDispatcher() noexcept = default;
+
+        EventDispatcher(EventDispatcher const& other) = delete;
+        EventDispatcher(EventDispatcher&& other) = delete;
+
+        EventDispatcher& operator=(EventDispatcher const& other) = delete;
+        EventDispatcher& operator=(EventDispatcher&& other) = delete;
+
+        ~EventDispatcher() noexcept = default;
+
+        bool register_handler(EventMask const event_mask, EventHandler const handler, void* const context) noexcept;
+
+        std::size_t decode(ADXL345::INT_SOURCE const int_source,
+                           std::optional<ADXL345::ACT_TAP_STATUS> const& act_tap_status,
+                           std::uint32_t const timestamp) noexcept;
+
+        std::size_t dispatch() noexcept;
+
+        EventMask get_event_mask() const noexcept;
+
+        std::uint32_t get_dropped_events() const noexcept;
+
+    private:
+        struct Registration {
+            EventMask event_mask{};
+            EventHandler handler{nullptr};
+            void* context{nullptr};
+        };
+
+        std::array<Registration, MAX_HANDLERS> registrations_{};
+        std::size_t registration_count_{};
+
+        EventMask event_mask_{};
+
+        RingBuffer::RingBuffer<Event, QUEUE_SIZE> events_{};
+
+        std::uint32_t dropped_events_{};
+    };
+
+}; // namespace EventDispatcher
+
+#endif // EVENT_DISPATCHER_HPP
@@ -0,0 +1,452 @@
+#include "i2c_bus_scheduler.hpp"
+#include <array>
+
+#ifdef ADXL345_LOW_POWER
+#include "low_power.hpp"
+#endif
+
+namespace I2CBusScheduler {
+
+    namespace {
+
+        struct CriticalSection {
+        public:
+            CriticalSection() noexcept : primask_{__get_PRIMASK()}
+            {
+                __disable_irq();
+            }
+
+            CriticalSection(CriticalSection const& other) = delete;
+            CriticalSection(CriticalSection&& other) = delete;
+
+            CriticalSection& operator=(CriticalSection const& other) = delete;
+            CriticalSection& operator=(CriticalSection&& other) = delete;
+
+            ~CriticalSection() noexcept
+            {
+                __set_PRIMASK(this->primask_);
+            }
+
+        private:
+            std::uint32_t primask_{};
+        };
+
+        struct Completion {
+            std::atomic<bool> done{false};
+            BusError bus_error{};
+            bool success{false};
+        };
+
+        std::array<I2CBusScheduler*, 3UZ> schedulers{};
+
+        I2CBusScheduler** get_scheduler(I2CBusHandle const i2c_bus) noexcept
+        {
+            if (i2c_bus == nullptr) {
+                return nullptr;
+            } else if (i2c_bus->Instance == I2C1) {
+                return &schedulers[0UZ];
+            } else if (i2c_bus->Instance == I2C2) {
+                return &schedulers[1UZ];
+            } else if (i2c_bus->Instance == I2C3) {
+                return &schedulers[2UZ];
+            }
+            return nullptr;
+        }
+
+        BusError get_bus_error(I2CBusHandle const i2c_bus) noexcept
+        {
+            auto const error = HAL_I2C_GetError(i2c_bus);
+            if ((error & HAL_I2C_ERROR_AF) != 0U) {
+                return BusError::NACK;
+            } else if ((error & HAL_I2C_ERROR_ARLO) != 0U) {
+                return BusError::ARBITRATION_LOST;
+            } else if ((error & HAL_I2C_ERROR_TIMEOUT) != 0U) {
+                return BusError::TIMEOUT;
+            }
+            return BusError::BUS_FAULT;
+        }
+
+        std::uint32_t get_ticks() noexcept
+        {
+#ifdef ADXL345_LOW_POWER
+            return static_cast<std::uint32_t>(LowPower::get_ticks());
+#else
+            return DWT->CYCCNT;
+#endif
+        }
+
+        std::uint32_t get_tick_frequency() noexcept
+        {
+#ifdef ADXL345_LOW_POWER
+            return LowPower::TICK_FREQUENCY;
+#else
+            return SystemCoreClock;
+#endif
+        }
+
+        bool wait(Completion const& completion, std::uint32_t const timeout_ms) noexcept
+        {
+            auto const start = HAL_GetTick();
+            while (!completion.done.load()) {
+                if (HAL_GetTick() - start > timeout_ms) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+    }; // namespace
+
+    I2CBusScheduler::I2CBusScheduler(I2CBusHandle const i2c_bus) noexcept : i2c_bus_{i2c_bus}
+    {
+        auto** const scheduler = get_scheduler(this->i2c_bus_);
+        if (scheduler == nullptr) {
+            this->i2c_bus_ = nullptr;
+            return;
+        }
+
+        *scheduler = this;
+
+        HAL_I2C_RegisterCallback(this->i2c_bus_,
+                                 HAL_I2C_MEM_TX_COMPLETE_CB_ID,
+                                 &I2CBusScheduler::transfer_complete_callback);
+        HAL_I2C_RegisterCallback(this->i2c_bus_,
+                                 HAL_I2C_MEM_RX_COMPLETE_CB_ID,
+                                 &I2CBusScheduler::transfer_complete_callback);
+        HAL_I2C_RegisterCallback(this->i2c_bus_, HAL_I2C_ERROR_CB_ID, &I2CBusScheduler::transfer_error_callback);
+        HAL_I2C_RegisterCallback(this->i2c_bus_, HAL_I2C_ABORT_CB_ID, &I2CBusScheduler::transfer_error_callback);
+
+#ifndef ADXL345_LOW_POWER
+        CoreDebug->DEMCR = CoreDebug->DEMCR | CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CTRL = DWT->CTRL | DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
+        this->bus_statistics_.start_tick = HAL_GetTick();
+    }
+
+    I2CBusScheduler::~I2CBusScheduler() noexcept
+    {
+        if (auto** const scheduler = get_scheduler(this->i2c_bus_); scheduler != nullptr && *scheduler == this) {
+            HAL_I2C_UnRegisterCallback(this->i2c_bus_, HAL_I2C_MEM_TX_COMPLETE_CB_ID);
+            HAL_I2C_UnRegisterCallback(this->i2c_bus_, HAL_I2C_MEM_RX_COMPLETE_CB_ID);
+            HAL_I2C_UnRegisterCallback(this->i2c_bus_, HAL_I2C_ERROR_CB_ID);
+            HAL_I2C_UnRegisterCallback(this->i2c_bus_, HAL_I2C_ABORT_CB_ID);
+            *scheduler = nullptr;
+        }
+    }
+
+    Expected<void> I2CBusScheduler::submit(Transaction const& transaction, Priority const priority) noexcept
+    {
+        if (this->i2c_bus_ == nullptr || transaction.bytes.empty()) {
+            return ::BusError::Unexpected{BusError::BUS_FAULT};
+        }
+
+        CriticalSection const critical_section{};
+
+        if (!this->queue_.push(transaction, priority)) {
+            ++this->bus_statistics_.rejected;
+            return ::BusError::Unexpected{BusError::BUSY};
+        }
+        this->start_next();
+
+        return {};
+    }
+
+    Expected<void> I2CBusScheduler::transfer(Transaction const& transaction, Priority const priority) noexcept
+    {
+        Completion completion{};
+
+        auto blocking = transaction;
+        blocking.callback = &I2CBusScheduler::transfer_done_callback;
+        blocking.context = &completion;
+
+        if (auto const result = this->submit(blocking, priority); !result.has_value()) {
+            return result;
+        }
+
+        if (!wait(completion, TIMEOUT_MS)) {
+            if (this->cancel(&completion)) {
+                return ::BusError::Unexpected{BusError::TIMEOUT};
+            }
+
+            this->abort();
+            if (!wait(completion, TIMEOUT_MS)) {
+                this->force_stop();
+            }
+            return ::BusError::Unexpected{BusError::TIMEOUT};
+        }
+
+        if (!completion.success) {
+            return ::BusError::Unexpected{completion.bus_error};
+        }
+
+        return {};
+    }
+
+    bool I2CBusScheduler::is_pending(std::uint16_t const device_address, Priority const priority) const noexcept
+    {
+        CriticalSection const critical_section{};
+
+        if (this->active_valid_ && this->active_.device_address == device_address &&
+            this->active_priority_ == priority) {
+            return true;
+        }
+
+        return this->queue_.contains(
+            [device_address, priority](Transaction const& transaction, Priority const transaction_priority) {
+                return transaction.device_address == device_address && transaction_priority == priority;
+            });
+    }
+
+    BusStatistics I2CBusScheduler::get_bus_statistics() const noexcept
+    {
+        CriticalSection const critical_section{};
+        return this->bus_statistics_;
+    }
+
+    void I2CBusScheduler::clear_bus_statistics() noexcept
+    {
+        CriticalSection const critical_section{};
+        this->bus_statistics_ = BusStatistics{.start_tick = HAL_GetTick()};
+    }
+
+    float I2CBusScheduler::get_utilization() const noexcept
+    {
+        auto const bus_statistics = this->get_bus_statistics();
+        return BusQueue::get_utilization(bus_statistics.busy_ticks,
+                                         HAL_GetTick() - bus_statistics.start_tick,
+                                         get_tick_frequency());
+    }
+
+    void I2CBusScheduler::transfer_complete_callback(I2CBusHandle const i2c_bus) noexcept
+    {
+        if (auto** const scheduler = get_scheduler(i2c_bus); scheduler != nullptr && *scheduler != nullptr) {
+            (*scheduler)->finish(true);
+        }
+    }
+
+    void I2CBusScheduler::transfer_error_callback(I2CBusHandle const i2c_bus) noexcept
+    {
+        if (auto** const scheduler = get_scheduler(i2c_bus); scheduler != nullptr && *scheduler != nullptr) {
+            (*scheduler)->finish(false);
+        }
+    }
+
+    void I2CBusScheduler::transfer_done_callback(void* const context,
+                                                 std::span<std::uint8_t const> const bytes) noexcept
+    {
+        auto* const completion = static_cast<Completion*>(context);
+        completion->success = !bytes.empty();
+        completion->done.store(true);
+    }
+
+    void I2CBusScheduler::start_next() noexcept
+    {
+        while (!this->active_valid_) {
+            auto const entry = this->queue_.pop();
+            if (!entry.has_value()) {
+                return;
+            }
+
+            this->active_ = entry->element;
+            this->active_priority_ = entry->priority;
+            this->active_valid_ = true;
+            this->active_start_ticks_ = get_ticks();
+
+            if (!this->start(this->active_)) {
+                this->finish(false);
+            }
+        }
+    }
+
+    bool I2CBusScheduler::start(Transaction const& transaction) noexcept
+    {
+        auto const device_address = static_cast<std::uint16_t>(transaction.device_address << 1U);
+        auto const size = static_cast<std::uint16_t>(transaction.bytes.size());
+
+        if (transaction.direction == Direction::READ && transaction.bytes.size() < DMA_READ_MIN_SIZE) {
+            return HAL_I2C_Mem_Read_IT(this->i2c_bus_,
+                                       device_address,
+                                       transaction.reg_address,
+                                       I2C_MEMADD_SIZE_8BIT,
+                                       transaction.bytes.data(),
+                                       size) == HAL_OK;
+        }
+
+        if (transaction.direction == Direction::READ) {
+            return HAL_I2C_Mem_Read_DMA(this->i2c_bus_,
+                                        device_address,
+                                        transaction.reg_address,
+                                        I2C_MEMADD_SIZE_8BIT,
+                                        transaction.bytes.data(),
+                                        size) == HAL_OK;
+        }
+
+        return HAL_I2C_Mem_Write_IT(this->i2c_bus_,
+                                    device_address,
+                                    transaction.reg_address,
+                                    I2C_MEMADD_SIZE_8BIT,
+                                    transaction.bytes.data(),
+                                    size) == HAL_OK;
+    }
+
+    void I2CBusScheduler::finish(bool const success) noexcept
+    {
+        auto transaction = Transaction{};
+        auto bus_error = BusError{};
+        {
+            CriticalSection const critical_section{};
+            if (!this->active_valid_) {
+                return;
+            }
+
+            transaction = this->active_;
+            bus_error = get_bus_error(this->i2c_bus_);
+            this->active_valid_ = false;
+
+            ++this->bus_statistics_.transactions;
+            if (!success) {
+                ++this->bus_statistics_.failures;
+            }
+            this->bus_statistics_.busy_ticks += get_ticks() - this->active_start_ticks_;
+
+            this->start_next();
+        }
+
+        if (transaction.callback == &I2CBusScheduler::transfer_done_callback) {
+            static_cast<Completion*>(transaction.context)->bus_error = bus_error;
+        }
+
+        if (transaction.callback != nullptr) {
+            transaction.callback(transaction.context, success ? transaction.bytes : std::span<std::uint8_t>{});
+        }
+    }
+
+    bool I2CBusScheduler::cancel(void* const context) noexcept
+    {
+        CriticalSection const critical_section{};
+
+        return this->queue_.erase([context](Transaction const& transaction) { return transaction.context == context; });
+    }
+
+    void I2CBusScheduler::abort() noexcept
+    {
+        auto device_address = std::uint16_t{};
+        {
+            CriticalSection const critical_section{};
+            if (!this->active_valid_) {
+                return;
+            }
+            device_address = static_cast<std::uint16_t>(this->active_.device_address << 1U);
+        }
+
+        HAL_I2C_Master_Abort_IT(this->i2c_bus_, device_address);
+    }
+
+    void I2CBusScheduler::force_stop() noexcept
+    {
+        {
+            CriticalSection const critical_section{};
+            if (!this->active_valid_) {
+                return;
+            }
+
+            __HAL_I2C_DISABLE_IT(this->i2c_bus_,
+                                 I2C_IT_ERRI | I2C_IT_TCI | I2C_IT_STOPI | I2C_IT_NACKI | I2C_IT_ADDRI | I2C_IT_RXI |
+                                     I2C_IT_TXI);
+            if (this->i2c_bus_->hdmarx != nullptr) {
+                HAL_DMA_Abort(this->i2c_bus_->hdmarx);
+            }
+            if (this->i2c_bus_->hdmatx != nullptr) {
+                HAL_DMA_Abort(this->i2c_bus_->hdmatx);
+            }
+
+            __HAL_I2C_DISABLE(this->i2c_bus_);
+            __HAL_I2C_ENABLE(this->i2c_bus_);
+
+            this->i2c_bus_->State = HAL_I2C_STATE_READY;
+            this->i2c_bus_->Mode = HAL_I2C_MODE_NONE;
+            this->i2c_bus_->XferCount = 0U;
+        }
+
+        this->finish(false);
+    }
+
+    I2CScheduledDevice::I2CScheduledDevice(I2CBusScheduler* const scheduler,
+                                           std::uint16_t const device_address,
+                                           PriorityMap const priority_map) noexcept :
+        scheduler_{scheduler}, device_address_{device_address}, priority_map_{priority_map}
+    {}
+
+    Expected<std::uint8_t> I2CScheduledDevice::read_byte(std::uint8_t const reg_address) const noexcept
+    {
+        auto byte = std::uint8_t{};
+        auto const result = this->read_bytes(reg_address, std::span{&byte, 1UZ});
+        return result.has_value() ? Expected<std::uint8_t>{byte}
+                                  : Expected<std::uint8_t>{::BusError::Unexpected{result.error()}};
+    }
+
+    Expected<void> I2CScheduledDevice::write_byte(std::uint8_t const reg_address,
+                                                  std::uint8_t const byte) const noexcept
+    {
+        return this->write_bytes(reg_address, std::span{&byte, 1UZ});
+    }
+
+    Expected<void> I2CScheduledDevice::read_bytes(std::uint8_t const reg_address,
+                                                  std::span<std::uint8_t> const bytes) const noexcept
+    {
+        if (this->scheduler_ == nullptr) {
+            return ::BusError::Unexpected{BusError::BUS_FAULT};
+        }
+
+        return this->scheduler_->transfer(Transaction{.device_address = this->device_address_,
+                                                      .reg_address = reg_address,
+                                                      .direction = Direction::READ,
+                                                      .bytes = bytes},
+                                          this->get_priority(reg_address));
+    }
+
+    Expected<void> I2CScheduledDevice::write_bytes(std::uint8_t const reg_address,
+                                                   std::span<std::uint8_t const> const bytes) const noexcept
+    {
+        if (this->scheduler_ == nullptr) {
+            return ::BusError::Unexpected{BusError::BUS_FAULT};
+        }
+
+        return this->scheduler_->transfer(
+            Transaction{.device_address = this->device_address_,
+                        .reg_address = reg_address,
+                        .direction = Direction::WRITE,
+                        .bytes = std::span{const_cast<std::uint8_t*>(bytes.data()), bytes.size()}},
+            this->get_priority(reg_address));
+    }
+
+    Expected<void> I2CScheduledDevice::read_bytes_dma(std::uint8_t const reg_address,
+                                                      std::span<std::uint8_t> const bytes,
+                                                      TransferCallback const callback,
+                                                      void* const context) const noexcept
+    {
+        if (this->scheduler_ == nullptr || callback == nullptr) {
+            return ::BusError::Unexpected{BusError::BUS_FAULT};
+        }
+
+        return this->scheduler_->submit(Transaction{.device_address = this->device_address_,
+                                                    .reg_address = reg_address,
+                                                    .direction = Direction::READ,
+                                                    .bytes = bytes,
+                                                    .callback = callback,
+                                                    .context = context},
+                                        this->get_priority(reg_address));
+    }
+
+    bool I2CScheduledDevice::is_busy() const noexcept
+    {
+        return this->scheduler_ != nullptr && this->scheduler_->is_pending(this->device_address_, Priority::DATA);
+    }
+
+    Priority I2CScheduledDevice::get_priority(std::uint8_t const reg_address) const noexcept
+    {
+        return this->priority_map_ != nullptr ? this->priority_map_(reg_address) : Priority::CONFIG;
+    }
+
+}; // namespace I2CBusScheduler
@@ -0,0 +1,145 @@
+#ifndef I2C_BUS_SCHEDULER_HPP
+#define I2C_BUS_SCHEDULER_HPP
+
+#include "bus_error.hpp"
+#include "bus_queue.hpp"
+#include "stm32l4xx_hal.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace I2CBusScheduler {
+
+    using I2CBusHandle = I2C_HandleTypeDef*;
+
+    using BusError = ::BusError::BusError;
+
+    template <typename T>
+    using Expected = ::BusError::Expected<T>;
+
+    using TransferCallback = void (*)(void* const context, std::span<std::uint8_t const> const bytes) noexcept;
+
+    std::size_t constexpr QUEUE_SIZE = 8UZ;
+
+    std::uint32_t constexpr TIMEOUT_MS = 100U;
+
+    std::size_t constexpr DMA_READ_MIN_SIZE = 6UZ;
+
+    enum struct Priority : std::uint8_t {
+        DATA,
+        CONFIG,
+    };
+
+    using PriorityMap = Priority (*)(std::uint8_t const reg_address) noexcept;
+
+    enum struct Direction : std::uint8_t {
+        READ,
+        WRITE,
+    };
+
+    struct Transaction {
+        std::uint16_t device_address{};
+        std::uint8_t reg_address{};
+        Direction direction{};
+        std::span<std::uint8_t> bytes{};
+        TransferCallback callback{nullptr};
+        void* context{nullptr};
+    };
+
+    using Queue = BusQueue::BusQueue<Transaction, Priority, QUEUE_SIZE>;
+
+    struct BusStatistics {
+        std::uint32_t transactions{};
+        std::uint32_t failures{};
+        std::uint32_t rejected{};
+        std::uint64_t busy_ticks{};
+        std::uint32_t start_tick{};
+    };
+
+    struct I2CBusScheduler {
+    public:
+        I2CBusScheduler() noexcept = default;
+        I2CBusScheduler(I2CBusHandle const i2c_bus) noexcept;
+
+        I2CBusScheduler(I2CBusScheduler const& other) = delete;
+        I2CBusScheduler(I2CBusScheduler&& other) = delete;
+
+        I2CBusScheduler& operator=(I2CBusScheduler const& other) = delete;
+        I2CBusScheduler& operator=(I2CBusScheduler&& other) = delete;
+
+        ~I2CBusScheduler() noexcept;
+
+        Expected<void> submit(Transaction const& transaction, Priority const priority) noexcept;
+
+        Expected<void> transfer(Transaction const& transaction, Priority const priority) noexcept;
+
+        bool is_pending(std::uint16_t const device_address, Priority const priority) const noexcept;
+
+        BusStatistics get_bus_statistics() const noexcept;
+        void clear_bus_statistics() noexcept;
+
+        float get_utilization() const noexcept;
+
+    private:
+        static void transfer_complete_callback(I2CBusHandle const i2c_bus) noexcept;
+        static void transfer_error_callback(I2CBusHandle const i2c_bus) noexcept;
+
+        static void transfer_done_callback(void* const context, std::span<std::uint8_t const> const bytes) noexcept;
+
+        void start_next() noexcept;
+        bool start(Transaction const& transaction) noexcept;
+        void finish(bool const success) noexcept;
+
+        bool cancel(void* const context) noexcept;
+        void abort() noexcept;
+        void force_stop() noexcept;
+
+        I2CBusHandle i2c_bus_{nullptr};
+
+        Queue queue_{};
+
+        Transaction active_{};
+        Priority active_priority_{};
+        bool active_valid_{false};
+        std::uint32_t active_start_ticks_{};
+
+        BusStatistics bus_statistics_{};
+    };
+
+    struct I2CScheduledDevice {
+    public:
+        I2CScheduledDevice() noexcept = default;
+        I2CScheduledDevice(I2CBusScheduler* const scheduler,
+                           std::uint16_t const device_address,
+                           PriorityMap const priority_map = nullptr) noexcept;
+
+        Expected<void> read_bytes(std::uint8_t const reg_address, std::span<std::uint8_t> const bytes) const noexcept;
+
+        Expected<std::uint8_t> read_byte(std::uint8_t const reg_address) const noexcept;
+
+        Expected<void> write_bytes(std::uint8_t const reg_address,
+                                   std::span<std::uint8_t const> const bytes) const noexcept;
+
+        Expected<void> write_byte(std::uint8_t const reg_address, std::uint8_t const byte) const noexcept;
+
+        Expected<void> read_bytes_dma(std::uint8_t const reg_address,
+                                      std::span<std::uint8_t> const bytes,
+                                      TransferCallback const callback,
+                                      void* const context) const noexcept;
+
+        bool is_busy() const noexcept;
+
+    private:
+        Priority get_priority(std::uint8_t const reg_address) const noexcept;
+
+        I2CBusScheduler* scheduler_{nullptr};
+
+        std::uint16_t device_address_{};
+
+        PriorityMap priority_map_{nullptr};
+    };
+
+}; // namespace I2CBusScheduler
+
+#endif // I2C_BUS_SCHEDULER_HPP
@@ -0,0 +1,134 @@
+#include "low_power.hpp"
+#include "stm32l4xx_hal.h"
+
+namespace LowPower {
+
+    namespace {
+
+        std::uint32_t constexpr COUNTER_BITS = 16U;
+        std::uint32_t constexpr COUNTER_MAX = 0xFFFFU;
+
+        std::uint64_t volatile overflows{};
+
+        bool tick_timer_started{false};
+
+        std::uint32_t read_counter() noexcept
+        {
+            auto counter = LPTIM1->CNT;
+            while (counter != LPTIM1->CNT) {
+                counter = LPTIM1->CNT;
+            }
+            return counter & COUNTER_MAX;
+        }
+
+        void restore_clocks() noexcept
+        {
+            __HAL_RCC_PLL_ENABLE();
+            while (__HAL_RCC_GET_FLAG(RCC_FLAG_PLLRDY) == 0U) {
+            }
+
+            __HAL_RCC_SYSCLK_CONFIG(RCC_SYSCLKSOURCE_PLLCLK);
+            while (__HAL_RCC_GET_SYSCLK_SOURCE() != RCC_SYSCLKSOURCE_STATUS_PLLCLK) {
+            }
+        }
+
+    }; // namespace
+
+    void start_tick_timer() noexcept
+    {
+        if (tick_timer_started) {
+            return;
+        }
+
+        __HAL_RCC_LSI_ENABLE();
+        while (__HAL_RCC_GET_FLAG(RCC_FLAG_LSIRDY) == 0U) {
+        }
+
+        __HAL_RCC_LPTIM1_CONFIG(RCC_LPTIM1CLKSOURCE_LSI);
+        __HAL_RCC_LPTIM1_CLK_ENABLE();
+        __HAL_RCC_LPTIM1_CLK_SLEEP_ENABLE();
+
+        LPTIM1->CR = 0U;
+        LPTIM1->CFGR = 0U;
+        LPTIM1->IER = LPTIM_IER_ARRMIE;
+        LPTIM1->CR = LPTIM_CR_ENABLE;
+        LPTIM1->ARR = COUNTER_MAX;
+        while ((LPTIM1->ISR & LPTIM_ISR_ARROK) == 0U) {
+        }
+        LPTIM1->ICR = LPTIM_ICR_ARROKCF;
+        LPTIM1->CR = LPTIM_CR_ENABLE | LPTIM_CR_CNTSTRT;
+
+        EXTI->IMR2 = EXTI->IMR2 | EXTI_IMR2_IM32;
+        HAL_NVIC_SetPriority(LPTIM1_IRQn, TICK_INT_PRIORITY, 0U);
+        HAL_NVIC_EnableIRQ(LPTIM1_IRQn);
+
+        __HAL_RCC_WAKEUPSTOP_CLK_CONFIG(RCC_STOP_WAKEUPCLOCK_HSI);
+
+        tick_timer_started = true;
+    }
+
+    std::uint64_t get_ticks() noexcept
+    {
+        auto const primask = __get_PRIMASK();
+        __disable_irq();
+
+        auto overflow_count = overflows;
+        auto const counter = read_counter();
+        if ((LPTIM1->ISR & LPTIM_ISR_ARRM) != 0U && counter < (COUNTER_MAX >> 1U)) {
+            ++overflow_count;
+        }
+
+        __set_PRIMASK(primask);
+        return (overflow_count << COUNTER_BITS) | counter;
+    }
+
+    std::uint32_t get_milliseconds() noexcept
+    {
+        return static_cast<std::uint32_t>(get_ticks() * MS_PER_S / TICK_FREQUENCY);
+    }
+
+    void tick_timer_irq_handler() noexcept
+    {
+        if ((LPTIM1->ISR & LPTIM_ISR_ARRM) != 0U) {
+            LPTIM1->ICR = LPTIM_ICR_ARRMCF;
+            overflows = overflows + 1U;
+        }
+    }
+
+    void enter_sleep() noexcept
+    {
+        __WFI();
+    }
+
+    void enter_stop2() noexcept
+    {
+        HAL_PWREx_EnterSTOP2Mode(PWR_STOPENTRY_WFI);
+        restore_clocks();
+    }
+
+}; // namespace LowPower
+
+extern "C" {
+
+    HAL_StatusTypeDef HAL_InitTick(std::uint32_t)
+    {
+        LowPower::start_tick_timer();
+        return HAL_OK;
+    }
+
+    std::uint32_t HAL_GetTick(void)
+    {
+        return LowPower::get_milliseconds();
+    }
+
+    void HAL_SuspendTick(void)
+    {}
+
+    void HAL_ResumeTick(void)
+    {}
+
+    void LPTIM1_IRQHandler(void)
+    {
+        LowPower::tick_timer_irq_handler();
+    }
+}
@@ -0,0 +1,26 @@
+#ifndef LOW_POWER_HPP
+#define LOW_POWER_HPP
+
+#include <cstdint>
+
+namespace LowPower {
+
+    std::uint32_t constexpr TICK_FREQUENCY = 32'000U;
+
+    std::uint32_t constexpr MS_PER_S = 1'000U;
+
+    void start_tick_timer() noexcept;
+
+    std::uint64_t get_ticks() noexcept;
+
+    std::uint32_t get_milliseconds() noexcept;
+
+    void tick_timer_irq_handler() noexcept;
+
+    void enter_sleep() noexcept;
+
+    void enter_stop2() noexcept;
+
+}; // namespace LowPower
+
+#endif // LOW_POWER_HPP
@@ -0,0 +1,92 @@
+#include "low_power_policy.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace LowPowerPolicy {
+
+    namespace {
+
+        float constexpr US_PER_S = 1'000'000.0F;
+
+        std::uint32_t samples_to_us(std::size_t const samples, float const sample_rate) noexcept
+        {
+            return static_cast<std::uint32_t>(std::lround(static_cast<float>(samples) * US_PER_S / sample_rate));
+        }
+
+    }; // namespace
+
+    WakeBudget compute_wake_budget(Parameters const& parameters,
+                                   float const sample_rate,
+                                   std::size_t const watermark) noexcept
+    {
+        if (sample_rate <= 0.0F || watermark == 0UZ || watermark >= parameters.fifo_size) {
+            return WakeBudget{};
+        }
+
+        auto const fill_time_us = samples_to_us(watermark, sample_rate);
+        auto const headroom_us = samples_to_us(parameters.fifo_size - watermark, sample_rate);
+
+        auto const drain_time_us = static_cast<std::uint32_t>(watermark) * parameters.drain_time_per_sample_us;
+        auto const active_time_us = parameters.wakeup_latency_us + drain_time_us + parameters.process_time_us;
+        auto const stop_time_us = fill_time_us > active_time_us ? fill_time_us - active_time_us : 0U;
+
+        return WakeBudget{
+            .fill_time_us = fill_time_us,
+            .headroom_us = headroom_us,
+            .active_time_us = active_time_us,
+            .stop_time_us = stop_time_us,
+            .duty_cycle = std::min(static_cast<float>(active_time_us) / static_cast<float>(fill_time_us), 1.0F),
+            .stop_allowed = active_time_us <= headroom_us && stop_time_us >= parameters.min_stop_time_us};
+    }
+
+    PowerMode select_power_mode(WakeBudget const& wake_budget, bool const work_pending) noexcept
+    {
+        if (work_pending) {
+            return PowerMode::RUN;
+        }
+
+        return wake_budget.stop_allowed ? PowerMode::STOP2 : PowerMode::SLEEP;
+    }
+
+    LowPowerPolicy::LowPowerPolicy(Parameters const& parameters) noexcept : parameters_{parameters}
+    {}
+
+    void LowPowerPolicy::update(float const sample_rate, std::size_t const watermark) noexcept
+    {
+        if (sample_rate == this->sample_rate_ && watermark == this->watermark_) {
+            return;
+        }
+
+        this->sample_rate_ = sample_rate;
+        this->watermark_ = watermark;
+        this->wake_budget_ = compute_wake_budget(this->parameters_, sample_rate, watermark);
+    }
+
+    PowerMode LowPowerPolicy::select_power_mode(bool const work_pending) noexcept
+    {
+        auto const power_mode = ::LowPowerPolicy::select_power_mode(this->wake_budget_, work_pending);
+        if (power_mode == PowerMode::STOP2) {
+            ++this->stop_entries_;
+        } else if (power_mode == PowerMode::SLEEP) {
+            ++this->sleep_entries_;
+        }
+
+        return power_mode;
+    }
+
+    WakeBudget const& LowPowerPolicy::get_wake_budget() const noexcept
+    {
+        return this->wake_budget_;
+    }
+
+    std::uint32_t LowPowerPolicy::get_stop_entries() const noexcept
+    {
+        return this->stop_entries_;
+    }
+
+    std::uint32_t LowPowerPolicy::get_sleep_entries() const noexcept
+    {
+        return this->sleep_entries_;
+    }
+
+}; // namespace LowPowerPolicy
@@ -0,0 +1,74 @@
+#ifndef LOW_POWER_POLICY_HPP
+#define LOW_POWER_POLICY_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace LowPowerPolicy {
+
+    enum struct PowerMode : std::uint8_t {
+        RUN,
+        SLEEP,
+        STOP2,
+    };
+
+    struct Parameters {
+        std::uint32_t wakeup_latency_us{};
+        std::uint32_t drain_time_per_sample_us{};
+        std::uint32_t process_time_us{};
+        std::uint32_t min_stop_time_us{};
+        std::size_t fifo_size{};
+    };
+
+    struct WakeBudget {
+        std::uint32_t fill_time_us{};
+        std::uint32_t headroom_us{};
+        std::uint32_t active_time_us{};
+        std::uint32_t stop_time_us{};
+        float duty_cycle{};
+        bool stop_allowed{};
+    };
+
+    WakeBudget compute_wake_budget(Parameters const& parameters,
+                                   float const sample_rate,
+                                   std::size_t const watermark) noexcept;
+
+    PowerMode select_power_mode(WakeBudget const& wake_budget, bool const work_pending) noexcept;
+
+    struct LowPowerPolicy {
+    public:
+        LowPowerPolicy() noexcept = default;
+        LowPowerPolicy(Parameters const& parameters) noexcept;
+
+        LowPowerPolicy(LowPowerPolicy const& other) noexcept = default;
+        LowPowerPolicy(LowPowerPolicy&& other) noexcept = default;
+
+        LowPowerPolicy& operator=(LowPowerPolicy const& other) noexcept = default;
+        LowPowerPolicy& operator=(LowPowerPolicy&& other) noexcept = default;
+
+        ~LowPowerPolicy() noexcept = default;
+
+        void update(float const sample_rate, std::size_t const watermark) noexcept;
+
+        PowerMode select_power_mode(bool const work_pending) noexcept;
+
+        WakeBudget const& get_wake_budget() const noexcept;
+
+        std::uint32_t get_stop_entries() const noexcept;
+        std::uint32_t get_sleep_entries() const noexcept;
+
+    private:
+        Parameters parameters_{};
+
+        float sample_rate_{};
+        std::size_t watermark_{};
+
+        WakeBudget wake_budget_{};
+
+        std::uint32_t stop_entries_{};
+        std::uint32_t sleep_entries_{};
+    };
+
+}; // namespace LowPowerPolicy
+
+#endif // LOW_POWER_POLICY_HPP
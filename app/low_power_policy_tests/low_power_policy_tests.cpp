@@ -0,0 +1,131 @@
+#include "low_power_policy.hpp"
+#include "unit_test.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace {
+
+    float constexpr SAMPLE_RATE = 1000.0F;
+    std::size_t constexpr WATERMARK = 16UZ;
+
+    LowPowerPolicy::Parameters constexpr PARAMETERS = {.wakeup_latency_us = 60U,
+                                                       .drain_time_per_sample_us = 100U,
+                                                       .process_time_us = 340U,
+                                                       .min_stop_time_us = 1000U,
+                                                       .fifo_size = 32UZ};
+
+    void test_budget(UnitTest::UnitTest& unit_test) noexcept
+    {
+        auto const wake_budget = LowPowerPolicy::compute_wake_budget(PARAMETERS, SAMPLE_RATE, WATERMARK);
+
+        unit_test.expect(wake_budget.fill_time_us == 16000U);
+        unit_test.expect(wake_budget.headroom_us == 16000U);
+        unit_test.expect(wake_budget.active_time_us == 2000U);
+        unit_test.expect(wake_budget.stop_time_us == 14000U);
+        unit_test.expect(wake_budget.duty_cycle == 0.125F);
+        unit_test.expect(wake_budget.stop_allowed);
+    }
+
+    void test_invalid_inputs(UnitTest::UnitTest& unit_test) noexcept
+    {
+        auto const no_rate = LowPowerPolicy::compute_wake_budget(PARAMETERS, 0.0F, WATERMARK);
+        auto const no_watermark = LowPowerPolicy::compute_wake_budget(PARAMETERS, SAMPLE_RATE, 0UZ);
+        auto const full_watermark = LowPowerPolicy::compute_wake_budget(PARAMETERS, SAMPLE_RATE, PARAMETERS.fifo_size);
+
+        unit_test.expect(!no_rate.stop_allowed && no_rate.fill_time_us == 0U);
+        unit_test.expect(!no_watermark.stop_allowed && no_watermark.fill_time_us == 0U);
+        unit_test.expect(!full_watermark.stop_allowed && full_watermark.fill_time_us == 0U);
+        unit_test.expect(LowPowerPolicy::select_power_mode(no_rate, false) == LowPowerPolicy::PowerMode::SLEEP);
+    }
+
+    void test_mode_thresholds(UnitTest::UnitTest& unit_test) noexcept
+    {
+        auto const slow = LowPowerPolicy::compute_wake_budget(PARAMETERS, SAMPLE_RATE, WATERMARK);
+        auto const fast = LowPowerPolicy::compute_wake_budget(PARAMETERS, 3200.0F, WATERMARK);
+
+        unit_test.expect(fast.fill_time_us == 5000U);
+        unit_test.expect(fast.stop_time_us == 3000U);
+        unit_test.expect(fast.stop_allowed);
+
+        auto const fastest = LowPowerPolicy::compute_wake_budget(PARAMETERS, 12800.0F, WATERMARK);
+        unit_test.expect(fastest.fill_time_us == 1250U);
+        unit_test.expect(fastest.stop_time_us == 0U);
+        unit_test.expect(fastest.duty_cycle == 1.0F);
+        unit_test.expect(!fastest.stop_allowed);
+
+        unit_test.expect(LowPowerPolicy::select_power_mode(slow, false) == LowPowerPolicy::PowerMode::STOP2);
+        unit_test.expect(LowPowerPolicy::select_power_mode(fastest, false) == LowPowerPolicy::PowerMode::SLEEP);
+    }
+
+    void test_work_pending(UnitTest::UnitTest& unit_test) noexcept
+    {
+        auto const slow = LowPowerPolicy::compute_wake_budget(PARAMETERS, SAMPLE_RATE, WATERMARK);
+        auto const fastest = LowPowerPolicy::compute_wake_budget(PARAMETERS, 12800.0F, WATERMARK);
+
+        unit_test.expect(LowPowerPolicy::select_power_mode(slow, true) == LowPowerPolicy::PowerMode::RUN);
+        unit_test.expect(LowPowerPolicy::select_power_mode(fastest, true) == LowPowerPolicy::PowerMode::RUN);
+    }
+
+    void test_min_stop_time_boundary(UnitTest::UnitTest& unit_test) noexcept
+    {
+        auto parameters = PARAMETERS;
+
+        parameters.min_stop_time_us = 14000U;
+        auto const at_boundary = LowPowerPolicy::compute_wake_budget(parameters, SAMPLE_RATE, WATERMARK);
+        unit_test.expect(at_boundary.stop_time_us == parameters.min_stop_time_us);
+        unit_test.expect(at_boundary.stop_allowed);
+
+        parameters.min_stop_time_us = 14001U;
+        auto const below_boundary = LowPowerPolicy::compute_wake_budget(parameters, SAMPLE_RATE, WATERMARK);
+        unit_test.expect(!below_boundary.stop_allowed);
+        unit_test.expect(LowPowerPolicy::select_power_mode(below_boundary, false) == LowPowerPolicy::PowerMode::SLEEP);
+    }
+
+    void test_headroom_boundary(UnitTest::UnitTest& unit_test) noexcept
+    {
+        auto parameters = PARAMETERS;
+        parameters.min_stop_time_us = 0U;
+        parameters.drain_time_per_sample_us = 975U;
+
+        auto const at_boundary = LowPowerPolicy::compute_wake_budget(parameters, SAMPLE_RATE, WATERMARK);
+        unit_test.expect(at_boundary.active_time_us == at_boundary.headroom_us);
+        unit_test.expect(at_boundary.stop_allowed);
+
+        parameters.process_time_us += 1U;
+        auto const over_boundary = LowPowerPolicy::compute_wake_budget(parameters, SAMPLE_RATE, WATERMARK);
+        unit_test.expect(over_boundary.active_time_us == over_boundary.headroom_us + 1U);
+        unit_test.expect(!over_boundary.stop_allowed);
+    }
+
+    void test_policy_entries(UnitTest::UnitTest& unit_test) noexcept
+    {
+        LowPowerPolicy::LowPowerPolicy low_power_policy{PARAMETERS};
+
+        low_power_policy.update(SAMPLE_RATE, WATERMARK);
+        unit_test.expect(low_power_policy.get_wake_budget().stop_time_us == 14000U);
+        unit_test.expect(low_power_policy.select_power_mode(false) == LowPowerPolicy::PowerMode::STOP2);
+        unit_test.expect(low_power_policy.select_power_mode(true) == LowPowerPolicy::PowerMode::RUN);
+
+        low_power_policy.update(12800.0F, WATERMARK);
+        unit_test.expect(low_power_policy.select_power_mode(false) == LowPowerPolicy::PowerMode::SLEEP);
+
+        unit_test.expect(low_power_policy.get_stop_entries() == 1U);
+        unit_test.expect(low_power_policy.get_sleep_entries() == 1U);
+    }
+
+}; // namespace
+
+int main()
+{
+    UnitTest::UnitTest unit_test{"low_power_policy_tests"};
+
+    unit_test.run("budget", test_budget);
+    unit_test.run("invalid inputs", test_invalid_inputs);
+    unit_test.run("mode thresholds", test_mode_thresholds);
+    unit_test.run("work pending", test_work_pending);
+    unit_test.run("min stop time boundary", test_min_stop_time_boundary);
+    unit_test.run("headroom boundary", test_headroom_boundary);
+    unit_test.run("policy entries", test_policy_entries);
+
+    return unit_test.report();
+}
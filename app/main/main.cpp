@@ -1,10 +1,255 @@
 #include "main.h"
+#include "acquisition.hpp"
+#include "adxl345.hpp"
+#include "dma.h"
+#include "gpio.h"
+#include "i2c.h"
+#include "spi.h"
+#include "usart.h"
+#include <algorithm>
+#include <cstdio>
+#include <numeric>
+#include <span>
+#include <utility>
+
+#ifdef ADXL345_LOW_POWER
+#include "low_power.hpp"
+#include "low_power_policy.hpp"
+#endif
+
+namespace {
+
+    Acquisition::Acquisition* acquisition_handle{nullptr};
+
+    std::size_t constexpr MAX_BLOCKS_PER_LOOP = 2UZ;
+
+    float constexpr REPORT_PERIOD_S = 1.0F;
+
+    struct Summary {
+        ADXL345::Vec3D<std::int32_t> sum{};
+        std::size_t samples{};
+        std::uint32_t timestamp{};
+        bool gap{};
+    };
+
+    std::int32_t sum_axis(std::span<std::int16_t const> const axis) noexcept
+    {
+        return std::accumulate(axis.begin(), axis.end(), std::int32_t{0});
+    }
+
+    void accumulate_block(Summary& summary, Acquisition::Block const& block) noexcept
+    {
+        if (block.samples.is_empty()) {
+            return;
+        }
+
+        summary.sum.x += sum_axis(block.samples.get_x());
+        summary.sum.y += sum_axis(block.samples.get_y());
+        summary.sum.z += sum_axis(block.samples.get_z());
+        summary.samples += block.samples.size();
+        summary.timestamp = block.timestamps[block.samples.size() - 1UZ];
+        summary.gap = summary.gap || block.gap;
+    }
+
+    void report_summary(Summary const& summary, Acquisition::LossStatistics const& loss_statistics) noexcept
+    {
+        auto const samples = static_cast<std::int32_t>(summary.samples);
+        std::printf("%lu: %u samples mean %ld %ld %ld\n\r",
+                    static_cast<unsigned long>(summary.timestamp),
+                    static_cast<unsigned>(summary.samples),
+                    static_cast<long>(summary.sum.x / samples),
+                    static_cast<long>(summary.sum.y / samples),
+                    static_cast<long>(summary.sum.z / samples));
+
+        if (summary.gap) {
+            std::printf("overruns %lu lost %llu dropped %lu gaps %lu\n\r",
+                        static_cast<unsigned long>(loss_statistics.overruns),
+                        static_cast<unsigned long long>(loss_statistics.lost_samples),
+                        static_cast<unsigned long>(loss_statistics.dropped_samples),
+                        static_cast<unsigned long>(loss_statistics.gaps));
+        }
+    }
+
+    void consume_blocks(Acquisition::Acquisition& acquisition, Summary& summary) noexcept
+    {
+        auto const pending = acquisition.get_blocks();
+        auto const blocks = pending.first(std::min(pending.size(), MAX_BLOCKS_PER_LOOP));
+        for (auto const& block : blocks) {
+            accumulate_block(summary, block);
+        }
+        acquisition.release_blocks(blocks.size());
+
+        auto const report_samples =
+            std::max(static_cast<std::size_t>(acquisition.get_nominal_sample_rate() * REPORT_PERIOD_S), 1UZ);
+        if (summary.samples >= report_samples) {
+            report_summary(summary, acquisition.get_loss_statistics());
+            summary = Summary{};
+        }
+    }
+
+#ifdef ADXL345_LOW_POWER
+#ifdef ADXL345_SPI
+    std::uint32_t constexpr DRAIN_TIME_PER_SAMPLE_US = 20U;
+#else
+    std::uint32_t constexpr DRAIN_TIME_PER_SAMPLE_US = 260U;
+#endif
+
+    LowPowerPolicy::Parameters constexpr LOW_POWER_PARAMETERS = {.wakeup_latency_us = 60U,
+                                                                 .drain_time_per_sample_us = DRAIN_TIME_PER_SAMPLE_US,
+                                                                 .process_time_us = 200U,
+                                                                 .min_stop_time_us = 1'000U,
+                                                                 .fifo_size = ADXL345::FIFO_SIZE};
+#endif
+
+#ifndef ADXL345_SPI
+    I2CBusScheduler::Priority get_register_priority(std::uint8_t const reg_address) noexcept
+    {
+        return ADXL345::get_register_access(reg_address) == ADXL345::Access::VOLATILE
+                   ? I2CBusScheduler::Priority::DATA
+                   : I2CBusScheduler::Priority::CONFIG;
+    }
+#endif
+
+    char const* event_type_to_string(EventDispatcher::EventType const event_type) noexcept
+    {
+        switch (event_type) {
+            case EventDispatcher::EventType::FREE_FALL:
+                return "free fall";
+            case EventDispatcher::EventType::INACTIVITY:
+                return "inactivity";
+            case EventDispatcher::EventType::ACTIVITY:
+                return "activity";
+            case EventDispatcher::EventType::DOUBLE_TAP:
+                return "double tap";
+            case EventDispatcher::EventType::SINGLE_TAP:
+                return "single tap";
+            default:
+                return "unknown";
+        }
+    }
+
+    void event_handler(void* const, EventDispatcher::Event const& event) noexcept
+    {
+        std::printf("%lu: %s %c%c%c\n\r",
+                    static_cast<unsigned long>(event.timestamp),
+                    event_type_to_string(event.type),
+                    event.axes.x ? 'x' : '-',
+                    event.axes.y ? 'y' : '-',
+                    event.axes.z ? 'z' : '-');
+    }
+
+}; // namespace
 
 int main()
 {
     HAL_Init();
     SystemClock_Config();
 
+    MX_GPIO_Init();
+    MX_DMA_Init();
+    MX_USART2_UART_Init();
+
+#ifdef ADXL345_SPI
+    MX_SPI2_Init();
+#else
+    MX_I2C1_Init();
+
+    static I2CBusScheduler::I2CBusScheduler i2c_bus_scheduler{&hi2c1};
+#endif
+
+    static Acquisition::Acquisition acquisition{
+#ifdef ADXL345_SPI
+        Acquisition::BusDevice{&hspi2, ADXL345_CS_GPIO_Port, ADXL345_CS_Pin},
+        Acquisition::DMADevice{&hspi2, ADXL345_CS_GPIO_Port, ADXL345_CS_Pin},
+#else
+        Acquisition::BusDevice{&i2c_bus_scheduler,
+                               std::to_underlying(ADXL345::DevAddress::ALT_LOW),
+                               &get_register_priority},
+        Acquisition::DMADevice{&i2c_bus_scheduler,
+                               std::to_underlying(ADXL345::DevAddress::ALT_LOW),
+                               &get_register_priority},
+#endif
+        ADXL345::Config{
+            .thresh_tap = {.thresh_tap = 48U},
+            .dur = {.dur = 16U},
+            .latent = {.latent = 80U},
+            .window = {.window = 200U},
+            .thresh_ff = {.thresh_ff = 7U},
+            .time_ff = {.time_ff = 40U},
+            .tap_axes = {.tap_z_en = 1U, .tap_y_en = 1U, .tap_x_en = 1U, .suppress = 1U},
+            .bw_rate = {.rate = std::to_underlying(ADXL345::DataRate::RATE_800HZ), .low_power = 0U},
+            .power_ctl = {.wakeup = 0U, .sleep = 0U, .measure = 1U, .auto_sleep = 0U, .link = 0U},
+            .int_enable = {.overrun = 0U,
+                           .watermark = 0U,
+                           .free_fall = 0U,
+                           .inactivity = 0U,
+                           .activity = 0U,
+                           .double_tap = 0U,
+                           .single_tap = 0U,
+                           .data_ready = 0U},
+            .int_map = {.overrun = 0U,
+                        .watermark = 0U,
+                        .free_fall = 0U,
+                        .inactivity = 0U,
+                        .activity = 0U,
+                        .double_tap = 0U,
+                        .single_tap = 0U,
+                        .data_ready = 0U},
+            .data_format = {.range = std::to_underlying(ADXL345::Range::FS_16G),
+                            .justify = 0U,
+                            .full_res = 1U,
+                            .int_invert = 1U,
+                            .spi = 0U,
+                            .self_test = 0U},
+            .fifo_ctl = {.samples = 0U, .trigger = 0U, .fifo_mode = std::to_underlying(ADXL345::FifoMode::BYPASS)}}};
+
+    acquisition_handle = &acquisition;
+    acquisition.load_or_calibrate_offsets();
+    acquisition.register_event_handler(EventDispatcher::ALL_EVENTS, &event_handler, nullptr);
+    acquisition.start_streaming();
+
+    Summary summary{};
+
+#ifdef ADXL345_LOW_POWER
+    LowPowerPolicy::LowPowerPolicy low_power_policy{LOW_POWER_PARAMETERS};
+#endif
+
     while (1) {
+        acquisition.process();
+
+        consume_blocks(acquisition, summary);
+
+#ifdef ADXL345_LOW_POWER
+        low_power_policy.update(acquisition.get_nominal_sample_rate(), acquisition.get_watermark());
+
+        __disable_irq();
+        if (!acquisition.has_pending_work() && acquisition.is_draining()) {
+            LowPower::enter_sleep();
+        } else {
+            switch (low_power_policy.select_power_mode(acquisition.has_pending_work())) {
+                case LowPowerPolicy::PowerMode::STOP2:
+                    LowPower::enter_stop2();
+                    break;
+                case LowPowerPolicy::PowerMode::SLEEP:
+                    LowPower::enter_sleep();
+                    break;
+                default:
+                    break;
+            }
+        }
+        __enable_irq();
+#else
+        __WFI();
+#endif
+    }
+}
+
+extern "C" {
+
+    void HAL_GPIO_EXTI_Callback(std::uint16_t GPIO_Pin)
+    {
+        if (GPIO_Pin == GPIO_PIN_5 && acquisition_handle != nullptr) {
+            acquisition_handle->interrupt_callback();
+        }
     }
 }
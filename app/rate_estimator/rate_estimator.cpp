@@ -0,0 +1,102 @@
+#include "rate_estimator.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace RateEstimator {
+
+    RateEstimator::RateEstimator(std::uint32_t const tick_frequency,
+                                 float const nominal_rate,
+                                 std::size_t const window) noexcept :
+        tick_frequency_{tick_frequency}
+    {
+        this->set_window(window);
+        this->set_nominal_rate(nominal_rate);
+    }
+
+    void RateEstimator::set_nominal_rate(float const nominal_rate) noexcept
+    {
+        this->nominal_period_ = nominal_rate > 0.0F ? static_cast<float>(this->tick_frequency_) / nominal_rate : 0.0F;
+        this->reset();
+    }
+
+    void RateEstimator::set_window(std::size_t const window) noexcept
+    {
+        this->window_ = std::clamp(window, 2UZ, MAX_WINDOW);
+        this->count_ = std::min(this->count_, this->window_);
+    }
+
+    void RateEstimator::update(std::uint64_t const sample_index, std::uint32_t const timestamp) noexcept
+    {
+        if (this->count_ > 0UZ) {
+            auto const& newest = this->get_anchor(0UZ);
+            if (sample_index <= newest.sample_index) {
+                return;
+            }
+
+            auto const period = static_cast<float>(timestamp - newest.timestamp) /
+                                static_cast<float>(sample_index - newest.sample_index);
+            if (!this->is_plausible_period(period)) {
+                this->count_ = 0UZ;
+            }
+        }
+
+        this->head_ = (this->head_ + 1UZ) % MAX_WINDOW;
+        this->anchors_[this->head_] = Anchor{.sample_index = sample_index, .timestamp = timestamp};
+        this->count_ = std::min(this->count_ + 1UZ, this->window_);
+
+        if (this->count_ < 2UZ) {
+            return;
+        }
+
+        auto ticks = std::uint64_t{};
+        for (auto age = 0UZ; age + 1UZ < this->count_; ++age) {
+            ticks += this->get_anchor(age).timestamp - this->get_anchor(age + 1UZ).timestamp;
+        }
+
+        auto const& oldest = this->get_anchor(this->count_ - 1UZ);
+        this->period_ = static_cast<float>(ticks) / static_cast<float>(sample_index - oldest.sample_index);
+    }
+
+    void RateEstimator::reset() noexcept
+    {
+        this->period_ = this->nominal_period_;
+        this->head_ = 0UZ;
+        this->count_ = 0UZ;
+    }
+
+    bool RateEstimator::is_locked() const noexcept
+    {
+        return this->count_ >= 2UZ;
+    }
+
+    float RateEstimator::get_sample_period() const noexcept
+    {
+        return this->period_;
+    }
+
+    float RateEstimator::get_sample_rate() const noexcept
+    {
+        return this->period_ > 0.0F ? static_cast<float>(this->tick_frequency_) / this->period_ : 0.0F;
+    }
+
+    float RateEstimator::get_nominal_rate() const noexcept
+    {
+        return this->nominal_period_ > 0.0F ? static_cast<float>(this->tick_frequency_) / this->nominal_period_ : 0.0F;
+    }
+
+    float RateEstimator::get_drift_ppm() const noexcept
+    {
+        return this->period_ > 0.0F ? (this->nominal_period_ / this->period_ - 1.0F) * 1'000'000.0F : 0.0F;
+    }
+
+    bool RateEstimator::is_plausible_period(float const period) const noexcept
+    {
+        return std::fabs(period - this->nominal_period_) <= this->nominal_period_ * MAX_PERIOD_DEVIATION;
+    }
+
+    RateEstimator::Anchor const& RateEstimator::get_anchor(std::size_t const age) const noexcept
+    {
+        return this->anchors_[(this->head_ + MAX_WINDOW - age) % MAX_WINDOW];
+    }
+
+}; // namespace RateEstimator
@@ -0,0 +1,67 @@
+#ifndef RATE_ESTIMATOR_HPP
+#define RATE_ESTIMATOR_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace RateEstimator {
+
+    std::size_t constexpr MAX_WINDOW = 16UZ;
+    std::size_t constexpr DEFAULT_WINDOW = 8UZ;
+
+    float constexpr MAX_PERIOD_DEVIATION = 0.25F;
+
+    struct RateEstimator {
+    public:
+        RateEstimator() noexcept = default;
+        RateEstimator(std::uint32_t const tick_frequency,
+                      float const nominal_rate,
+                      std::size_t const window = DEFAULT_WINDOW) noexcept;
+
+        RateEstimator(RateEstimator const& other) noexcept = default;
+        RateEstimator(RateEstimator&& other) noexcept = default;
+
+        RateEstimator& operator=(RateEstimator const& other) noexcept = default;
+        RateEstimator& operator=(RateEstimator&& other) noexcept = default;
+
+        ~RateEstimator() noexcept = default;
+
+        void set_nominal_rate(float const nominal_rate) noexcept;
+        void set_window(std::size_t const window) noexcept;
+
+        void update(std::uint64_t const sample_index, std::uint32_t const timestamp) noexcept;
+
+        void reset() noexcept;
+
+        bool is_locked() const noexcept;
+
+        float get_sample_period() const noexcept;
+        float get_sample_rate() const noexcept;
+        float get_nominal_rate() const noexcept;
+        float get_drift_ppm() const noexcept;
+
+    private:
+        struct Anchor {
+            std::uint64_t sample_index{};
+            std::uint32_t timestamp{};
+        };
+
+        bool is_plausible_period(float const period) const noexcept;
+
+        Anchor const& get_anchor(std::size_t const age) const noexcept;
+
+        std::uint32_t tick_frequency_{};
+
+        float nominal_period_{};
+        float period_{};
+
+        std::array<Anchor, MAX_WINDOW> anchors_{};
+        std::size_t head_{};
+        std::size_t count_{};
+        std::size_t window_{DEFAULT_WINDOW};
+    };
+
+}; // namespace RateEstimator
+
+#endif // RATE_ESTIMATOR_HPP
@@ -0,0 +1,70 @@
+#include "resampler.hpp"
+#include <cmath>
+
+namespace Resampler {
+
+    Resampler::Resampler(float const input_rate, float const output_rate) noexcept :
+        input_rate_{input_rate}, output_rate_{output_rate}, step_{input_rate / output_rate}
+    {}
+
+    void Resampler::set_input_rate(float const input_rate) noexcept
+    {
+        this->input_rate_ = input_rate;
+        this->step_ = this->input_rate_ / this->output_rate_;
+    }
+
+    void Resampler::set_output_rate(float const output_rate) noexcept
+    {
+        this->output_rate_ = output_rate;
+        this->step_ = this->input_rate_ / this->output_rate_;
+    }
+
+    ProcessResult Resampler::process(std::span<Vec3D<float> const> const input,
+                                     std::span<Vec3D<float>> const output) noexcept
+    {
+        auto result = ProcessResult{};
+        for (; result.consumed < input.size(); ++result.consumed) {
+            auto const& current = input[result.consumed];
+            if (!this->primed_) {
+                this->previous_ = current;
+                this->primed_ = true;
+                continue;
+            }
+
+            while (this->position_ < 1.0F) {
+                if (result.produced == output.size()) {
+                    return result;
+                }
+                output[result.produced++] = interpolate(this->previous_, current, this->position_);
+                this->position_ += this->step_;
+            }
+
+            this->position_ -= 1.0F;
+            this->previous_ = current;
+        }
+        return result;
+    }
+
+    void Resampler::reset() noexcept
+    {
+        this->position_ = 0.0F;
+        this->primed_ = false;
+    }
+
+    std::size_t Resampler::get_max_output_size(std::size_t const input_size,
+                                               float const input_rate,
+                                               float const output_rate) noexcept
+    {
+        return static_cast<std::size_t>(std::ceil(static_cast<float>(input_size) * output_rate / input_rate)) + 1UZ;
+    }
+
+    Vec3D<float> Resampler::interpolate(Vec3D<float> const& previous,
+                                        Vec3D<float> const& current,
+                                        float const fraction) noexcept
+    {
+        return Vec3D<float>{std::lerp(previous.x, current.x, fraction),
+                            std::lerp(previous.y, current.y, fraction),
+                            std::lerp(previous.z, current.z, fraction)};
+    }
+
+}; // namespace Resampler
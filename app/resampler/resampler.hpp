@@ -0,0 +1,59 @@
+#ifndef RESAMPLER_HPP
+#define RESAMPLER_HPP
+
+#include "vector3d.hpp"
+#include <cstddef>
+#include <span>
+
+namespace Resampler {
+
+    template <typename T>
+    using Vec3D = Utility::Vector3D<T>;
+
+    struct ProcessResult {
+        std::size_t consumed{};
+        std::size_t produced{};
+    };
+
+    struct Resampler {
+    public:
+        Resampler() noexcept = default;
+        Resampler(float const input_rate, float const output_rate) noexcept;
+
+        Resampler(Resampler const& other) noexcept = default;
+        Resampler(Resampler&& other) noexcept = default;
+
+        Resampler& operator=(Resampler const& other) noexcept = default;
+        Resampler& operator=(Resampler&& other) noexcept = default;
+
+        ~Resampler() noexcept = default;
+
+        void set_input_rate(float const input_rate) noexcept;
+        void set_output_rate(float const output_rate) noexcept;
+
+        ProcessResult process(std::span<Vec3D<float> const> const input, std::span<Vec3D<float>> const output) noexcept;
+
+        void reset() noexcept;
+
+        static std::size_t get_max_output_size(std::size_t const input_size,
+                                               float const input_rate,
+                                               float const output_rate) noexcept;
+
+    private:
+        static Vec3D<float> interpolate(Vec3D<float> const& previous,
+                                        Vec3D<float> const& current,
+                                        float const fraction) noexcept;
+
+        float input_rate_{1.0F};
+        float output_rate_{1.0F};
+
+        float step_{1.0F};
+        float position_{};
+
+        Vec3D<float> previous_{};
+        bool primed_{false};
+    };
+
+}; // namespace Resampler
+
+#endif // RESAMPLER_HPP
@@ -0,0 +1,168 @@
+#ifndef RING_BUFFER_HPP
+#define RING_BUFFER_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <optional>
+#include <span>
+
+namespace RingBuffer {
+
+    template <typename T, std::size_t SIZE>
+    struct RingBuffer {
+    public:
+        static_assert(std::has_single_bit(SIZE));
+        static_assert(std::atomic<std::size_t>::is_always_lock_free);
+
+        RingBuffer() noexcept = default;
+
+        RingBuffer(RingBuffer const& other) = delete;
+        RingBuffer(RingBuffer&& other) = delete;
+
+        RingBuffer& operator=(RingBuffer const& other) = delete;
+        RingBuffer& operator=(RingBuffer&& other) = delete;
+
+        ~RingBuffer() noexcept = default;
+
+        bool push(T const& element) noexcept;
+        std::size_t push_bulk(std::span<T const> const elements) noexcept;
+
+        std::span<T> get_push_span() noexcept;
+        void commit_push(std::size_t const count) noexcept;
+
+        std::optional<T> pop() noexcept;
+        std::size_t pop_bulk(std::span<T> const elements) noexcept;
+
+        std::span<T const> get_pop_span() const noexcept;
+        void commit_pop(std::size_t const count) noexcept;
+
+        bool is_empty() const noexcept;
+        bool is_full() const noexcept;
+
+        std::size_t size() const noexcept;
+
+        static constexpr std::size_t capacity() noexcept
+        {
+            return SIZE;
+        }
+
+    private:
+        static constexpr std::size_t MASK = SIZE - 1UZ;
+
+        std::array<T, SIZE> elements_{};
+
+        std::atomic<std::size_t> head_{};
+        std::atomic<std::size_t> tail_{};
+    };
+
+    template <typename T, std::size_t SIZE>
+    inline bool RingBuffer<T, SIZE>::push(T const& element) noexcept
+    {
+        auto const head = this->head_.load(std::memory_order_relaxed);
+        if (head - this->tail_.load(std::memory_order_acquire) == SIZE) {
+            return false;
+        }
+
+        this->elements_[head & MASK] = element;
+        this->head_.store(head + 1UZ, std::memory_order_release);
+        return true;
+    }
+
+    template <typename T, std::size_t SIZE>
+    inline std::size_t RingBuffer<T, SIZE>::push_bulk(std::span<T const> const elements) noexcept
+    {
+        auto const head = this->head_.load(std::memory_order_relaxed);
+        auto const free = SIZE - (head - this->tail_.load(std::memory_order_acquire));
+        auto const count = std::min(elements.size(), free);
+
+        auto const first = std::min(count, SIZE - (head & MASK));
+        std::ranges::copy(elements.first(first),
+                          std::next(this->elements_.begin(), static_cast<std::ptrdiff_t>(head & MASK)));
+        std::ranges::copy(elements.subspan(first, count - first), this->elements_.begin());
+
+        this->head_.store(head + count, std::memory_order_release);
+        return count;
+    }
+
+    template <typename T, std::size_t SIZE>
+    inline std::span<T> RingBuffer<T, SIZE>::get_push_span() noexcept
+    {
+        auto const head = this->head_.load(std::memory_order_relaxed);
+        auto const free = SIZE - (head - this->tail_.load(std::memory_order_acquire));
+        return std::span<T>{this->elements_}.subspan(head & MASK, std::min(free, SIZE - (head & MASK)));
+    }
+
+    template <typename T, std::size_t SIZE>
+    inline void RingBuffer<T, SIZE>::commit_push(std::size_t const count) noexcept
+    {
+        this->head_.store(this->head_.load(std::memory_order_relaxed) + count, std::memory_order_release);
+    }
+
+    template <typename T, std::size_t SIZE>
+    inline std::optional<T> RingBuffer<T, SIZE>::pop() noexcept
+    {
+        auto const tail = this->tail_.load(std::memory_order_relaxed);
+        if (tail == this->head_.load(std::memory_order_acquire)) {
+            return std::nullopt;
+        }
+
+        auto const element = this->elements_[tail & MASK];
+        this->tail_.store(tail + 1UZ, std::memory_order_release);
+        return element;
+    }
+
+    template <typename T, std::size_t SIZE>
+    inline std::size_t RingBuffer<T, SIZE>::pop_bulk(std::span<T> const elements) noexcept
+    {
+        auto const tail = this->tail_.load(std::memory_order_relaxed);
+        auto const used = this->head_.load(std::memory_order_acquire) - tail;
+        auto const count = std::min(elements.size(), used);
+
+        auto const first = std::min(count, SIZE - (tail & MASK));
+        auto const source = std::span<T const>{this->elements_};
+        std::ranges::copy(source.subspan(tail & MASK, first), elements.begin());
+        std::ranges::copy(source.first(count - first), std::next(elements.begin(), static_cast<std::ptrdiff_t>(first)));
+
+        this->tail_.store(tail + count, std::memory_order_release);
+        return count;
+    }
+
+    template <typename T, std::size_t SIZE>
+    inline std::span<T const> RingBuffer<T, SIZE>::get_pop_span() const noexcept
+    {
+        auto const tail = this->tail_.load(std::memory_order_relaxed);
+        auto const used = this->head_.load(std::memory_order_acquire) - tail;
+        return std::span<T const>{this->elements_}.subspan(tail & MASK, std::min(used, SIZE - (tail & MASK)));
+    }
+
+    template <typename T, std::size_t SIZE>
+    inline void RingBuffer<T, SIZE>::commit_pop(std::size_t const count) noexcept
+    {
+        this->tail_.store(this->tail_.load(std::memory_order_relaxed) + count, std::memory_order_release);
+    }
+
+    template <typename T, std::size_t SIZE>
+    inline bool RingBuffer<T, SIZE>::is_empty() const noexcept
+    {
+        return this->size() == 0UZ;
+    }
+
+    template <typename T, std::size_t SIZE>
+    inline bool RingBuffer<T, SIZE>::is_full() const noexcept
+    {
+        return this->size() == SIZE;
+    }
+
+    template <typename T, std::size_t SIZE>
+    inline std::size_t RingBuffer<T, SIZE>::size() const noexcept
+    {
+        auto const tail = this->tail_.load(std::memory_order_acquire);
+        return this->head_.load(std::memory_order_acquire) - tail;
+    }
+
+}; // namespace RingBuffer
+
+#endif // RING_BUFFER_HPP
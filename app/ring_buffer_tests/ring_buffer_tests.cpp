@@ -0,0 +1,136 @@
+#include "ring_buffer.hpp"
+#include "unit_test.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <numeric>
+
+namespace {
+
+    std::size_t constexpr SIZE = 8UZ;
+
+    using Buffer = RingBuffer::RingBuffer<int, SIZE>;
+
+    void advance(Buffer& buffer, std::size_t const count) noexcept
+    {
+        for (auto index = 0UZ; index < count; ++index) {
+            buffer.push(0);
+            buffer.pop();
+        }
+    }
+
+    void test_empty(UnitTest::UnitTest& unit_test) noexcept
+    {
+        Buffer buffer{};
+        std::array<int, SIZE> elements{};
+
+        unit_test.expect(buffer.is_empty());
+        unit_test.expect(!buffer.is_full());
+        unit_test.expect(buffer.size() == 0UZ);
+        unit_test.expect(!buffer.pop().has_value());
+        unit_test.expect(buffer.pop_bulk(elements) == 0UZ);
+        unit_test.expect(buffer.get_pop_span().empty());
+        unit_test.expect(buffer.get_push_span().size() == SIZE);
+    }
+
+    void test_full(UnitTest::UnitTest& unit_test) noexcept
+    {
+        Buffer buffer{};
+        for (auto index = 0UZ; index < SIZE; ++index) {
+            unit_test.expect(buffer.push(static_cast<int>(index)));
+        }
+
+        std::array<int, 2UZ> const more{100, 101};
+        unit_test.expect(buffer.is_full());
+        unit_test.expect(buffer.size() == SIZE);
+        unit_test.expect(!buffer.push(100));
+        unit_test.expect(buffer.push_bulk(more) == 0UZ);
+        unit_test.expect(buffer.get_push_span().empty());
+
+        unit_test.expect(buffer.pop() == 0);
+        unit_test.expect(!buffer.is_full());
+        unit_test.expect(buffer.push(100));
+        unit_test.expect(buffer.is_full());
+    }
+
+    void test_wraparound(UnitTest::UnitTest& unit_test) noexcept
+    {
+        Buffer buffer{};
+        advance(buffer, SIZE - 2UZ);
+
+        for (auto index = 0; index < 5; ++index) {
+            unit_test.expect(buffer.push(index));
+        }
+        unit_test.expect(buffer.size() == 5UZ);
+
+        for (auto index = 0; index < 5; ++index) {
+            unit_test.expect(buffer.pop() == index);
+        }
+        unit_test.expect(buffer.is_empty());
+    }
+
+    void test_partial_bulk(UnitTest::UnitTest& unit_test) noexcept
+    {
+        Buffer buffer{};
+        advance(buffer, SIZE - 3UZ);
+
+        std::array<int, SIZE + 2UZ> pushed{};
+        std::iota(pushed.begin(), pushed.end(), 10);
+
+        unit_test.expect(buffer.push_bulk(std::span{pushed}.first(5UZ)) == 5UZ);
+        unit_test.expect(buffer.push_bulk(std::span{pushed}.subspan(5UZ)) == SIZE - 5UZ);
+        unit_test.expect(buffer.is_full());
+
+        std::array<int, 3UZ> first{};
+        unit_test.expect(buffer.pop_bulk(first) == first.size());
+        unit_test.expect(std::ranges::equal(first, std::span{pushed}.first(3UZ)));
+
+        std::array<int, SIZE> rest{};
+        unit_test.expect(buffer.pop_bulk(rest) == SIZE - 3UZ);
+        unit_test.expect(
+            std::ranges::equal(std::span{rest}.first(SIZE - 3UZ), std::span{pushed}.subspan(3UZ, SIZE - 3UZ)));
+        unit_test.expect(buffer.is_empty());
+    }
+
+    void test_spans_across_wrap(UnitTest::UnitTest& unit_test) noexcept
+    {
+        Buffer buffer{};
+        advance(buffer, SIZE - 2UZ);
+
+        auto tail_span = buffer.get_push_span();
+        unit_test.expect(tail_span.size() == 2UZ);
+        std::iota(tail_span.begin(), tail_span.end(), 0);
+        buffer.commit_push(tail_span.size());
+
+        auto head_span = buffer.get_push_span();
+        unit_test.expect(head_span.size() == SIZE - 2UZ);
+        std::iota(head_span.begin(), std::next(head_span.begin(), 3), 2);
+        buffer.commit_push(3UZ);
+        unit_test.expect(buffer.size() == 5UZ);
+
+        auto const first_pop_span = buffer.get_pop_span();
+        unit_test.expect(first_pop_span.size() == 2UZ);
+        unit_test.expect(first_pop_span.front() == 0 && first_pop_span.back() == 1);
+        buffer.commit_pop(first_pop_span.size());
+
+        auto const second_pop_span = buffer.get_pop_span();
+        unit_test.expect(second_pop_span.size() == 3UZ);
+        unit_test.expect(std::ranges::equal(second_pop_span, std::array{2, 3, 4}));
+        buffer.commit_pop(second_pop_span.size());
+        unit_test.expect(buffer.is_empty());
+    }
+
+}; // namespace
+
+int main()
+{
+    UnitTest::UnitTest unit_test{"ring_buffer_tests"};
+
+    unit_test.run("empty", test_empty);
+    unit_test.run("full", test_full);
+    unit_test.run("wraparound", test_wraparound);
+    unit_test.run("partial bulk", test_partial_bulk);
+    unit_test.run("spans across wrap", test_spans_across_wrap);
+
+    return unit_test.report();
+}
@@ -0,0 +1,141 @@
+#ifndef SAMPLE_BLOCK_HPP
+#define SAMPLE_BLOCK_HPP
+
+#include "vector3d.hpp"
+#include <array>
+#include <cstddef>
+#include <span>
+
+namespace SampleBlock {
+
+    template <typename T>
+    using Vec3D = Utility::Vector3D<T>;
+
+    template <typename T, std::size_t SIZE>
+    struct SampleBlock {
+    public:
+        SampleBlock() noexcept = default;
+
+        SampleBlock(SampleBlock const& other) noexcept = default;
+        SampleBlock(SampleBlock&& other) noexcept = default;
+
+        SampleBlock& operator=(SampleBlock const& other) noexcept = default;
+        SampleBlock& operator=(SampleBlock&& other) noexcept = default;
+
+        ~SampleBlock() noexcept = default;
+
+        bool push(Vec3D<T> const& sample) noexcept;
+
+        void clear() noexcept;
+
+        std::span<T> get_x() noexcept;
+        std::span<T> get_y() noexcept;
+        std::span<T> get_z() noexcept;
+
+        std::span<T const> get_x() const noexcept;
+        std::span<T const> get_y() const noexcept;
+        std::span<T const> get_z() const noexcept;
+
+        Vec3D<T> get_sample(std::size_t const index) const noexcept;
+
+        bool is_empty() const noexcept;
+        bool is_full() const noexcept;
+
+        std::size_t size() const noexcept;
+
+        static constexpr std::size_t capacity() noexcept
+        {
+            return SIZE;
+        }
+
+    private:
+        std::array<T, SIZE> x_{};
+        std::array<T, SIZE> y_{};
+        std::array<T, SIZE> z_{};
+
+        std::size_t size_{};
+    };
+
+    template <typename T, std::size_t SIZE>
+    inline bool SampleBlock<T, SIZE>::push(Vec3D<T> const& sample) noexcept
+    {
+        if (this->size_ == SIZE) {
+            return false;
+        }
+
+        this->x_[this->size_] = sample.x;
+        this->y_[this->size_] = sample.y;
+        this->z_[this->size_] = sample.z;
+        ++this->size_;
+        return true;
+    }
+
+    template <typename T, std::size_t SIZE>
+    inline void SampleBlock<T, SIZE>::clear() noexcept
+    {
+        this->size_ = 0UZ;
+    }
+
+    template <typename T, std::size_t SIZE>
+    inline std::span<T> SampleBlock<T, SIZE>::get_x() noexcept
+    {
+        return std::span<T>{this->x_}.first(this->size_);
+    }
+
+    template <typename T, std::size_t SIZE>
+    inline std::span<T> SampleBlock<T, SIZE>::get_y() noexcept
+    {
+        return std::span<T>{this->y_}.first(this->size_);
+    }
+
+    template <typename T, std::size_t SIZE>
+    inline std::span<T> SampleBlock<T, SIZE>::get_z() noexcept
+    {
+        return std::span<T>{this->z_}.first(this->size_);
+    }
+
+    template <typename T, std::size_t SIZE>
+    inline std::span<T const> SampleBlock<T, SIZE>::get_x() const noexcept
+    {
+        return std::span<T const>{this->x_}.first(this->size_);
+    }
+
+    template <typename T, std::size_t SIZE>
+    inline std::span<T const> SampleBlock<T, SIZE>::get_y() const noexcept
+    {
+        return std::span<T const>{this->y_}.first(this->size_);
+    }
+
+    template <typename T, std::size_t SIZE>
+    inline std::span<T const> SampleBlock<T, SIZE>::get_z() const noexcept
+    {
+        return std::span<T const>{this->z_}.first(this->size_);
+    }
+
+    template <typename T, std::size_t SIZE>
+    inline Vec3D<T> SampleBlock<T, SIZE>::get_sample(std::size_t const index) const noexcept
+    {
+        return Vec3D<T>{this->x_[index], this->y_[index], this->z_[index]};
+    }
+
+    template <typename T, std::size_t SIZE>
+    inline bool SampleBlock<T, SIZE>::is_empty() const noexcept
+    {
+        return this->size_ == 0UZ;
+    }
+
+    template <typename T, std::size_t SIZE>
+    inline bool SampleBlock<T, SIZE>::is_full() const noexcept
+    {
+        return this->size_ == SIZE;
+    }
+
+    template <typename T, std::size_t SIZE>
+    inline std::size_t SampleBlock<T, SIZE>::size() const noexcept
+    {
+        return this->size_;
+    }
+
+}; // namespace SampleBlock
+
+#endif // SAMPLE_BLOCK_HPP
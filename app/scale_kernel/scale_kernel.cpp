@@ -0,0 +1,59 @@
+#include "scale_kernel.hpp"
+#include "arm_math.h"
+#include <algorithm>
+#include <cstddef>
+
+namespace ScaleKernel {
+
+    namespace {
+
+        std::size_t constexpr AXES = 3UZ;
+
+        float constexpr Q15_SCALE = 32768.0F;
+
+        static_assert(sizeof(Vec3D<std::int16_t>) == AXES * sizeof(q15_t));
+        static_assert(sizeof(Vec3D<float>) == AXES * sizeof(float32_t));
+
+    }; // namespace
+
+    void raw_to_scaled(std::span<Vec3D<std::int16_t> const> const raw,
+                       std::span<Vec3D<float>> const scaled,
+                       float const scale) noexcept
+    {
+        auto const count = static_cast<std::uint32_t>(AXES * std::min(raw.size(), scaled.size()));
+        auto* const values = reinterpret_cast<float32_t*>(scaled.data());
+
+        arm_q15_to_float(reinterpret_cast<q15_t const*>(raw.data()), values, count);
+        arm_scale_f32(values, scale * Q15_SCALE, values, count);
+    }
+
+    void raw_to_milli_g(std::span<Vec3D<std::int16_t> const> const raw,
+                        std::span<Vec3D<std::int32_t>> const milli_g,
+                        std::uint8_t const lsb_shift) noexcept
+    {
+        auto const rounding = std::int32_t{1} << (lsb_shift - 1U);
+        auto const convert = [rounding, lsb_shift](std::int16_t const value) {
+            return (static_cast<std::int32_t>(value) * MILLI_G_PER_G + rounding) >> lsb_shift;
+        };
+
+        std::transform(raw.begin(),
+                       std::next(raw.begin(), static_cast<std::ptrdiff_t>(std::min(raw.size(), milli_g.size()))),
+                       milli_g.begin(),
+                       [&convert](Vec3D<std::int16_t> const& sample) {
+                           return Vec3D<std::int32_t>{convert(sample.x), convert(sample.y), convert(sample.z)};
+                       });
+    }
+
+    void raw_to_scaled_reference(std::span<Vec3D<std::int16_t> const> const raw,
+                                 std::span<Vec3D<float>> const scaled,
+                                 float const scale) noexcept
+    {
+        std::transform(raw.begin(),
+                       std::next(raw.begin(), static_cast<std::ptrdiff_t>(std::min(raw.size(), scaled.size()))),
+                       scaled.begin(),
+                       [scale](Vec3D<std::int16_t> const& sample) {
+                           return static_cast<Vec3D<float>>(sample) * scale;
+                       });
+    }
+
+}; // namespace ScaleKernel
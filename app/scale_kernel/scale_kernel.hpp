@@ -0,0 +1,30 @@
+#ifndef SCALE_KERNEL_HPP
+#define SCALE_KERNEL_HPP
+
+#include "vector3d.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace ScaleKernel {
+
+    template <typename T>
+    using Vec3D = Utility::Vector3D<T>;
+
+    std::int32_t constexpr MILLI_G_PER_G = 1000;
+
+    void raw_to_scaled(std::span<Vec3D<std::int16_t> const> const raw,
+                       std::span<Vec3D<float>> const scaled,
+                       float const scale) noexcept;
+
+    void raw_to_milli_g(std::span<Vec3D<std::int16_t> const> const raw,
+                        std::span<Vec3D<std::int32_t>> const milli_g,
+                        std::uint8_t const lsb_shift) noexcept;
+
+    void raw_to_scaled_reference(std::span<Vec3D<std::int16_t> const> const raw,
+                                 std::span<Vec3D<float>> const scaled,
+                                 float const scale) noexcept;
+
+}; // namespace ScaleKernel
+
+#endif // SCALE_KERNEL_HPP
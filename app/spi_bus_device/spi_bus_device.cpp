@@ -0,0 +1,270 @@
+#include "spi_bus_device.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <iterator>
+
+namespace SPIBusDevice {
+
+    namespace {
+
+        struct Bus {
+            std::atomic<bool> locked{false};
+            std::uint32_t deselect_cycles{};
+            std::span<std::uint8_t> bytes{};
+            void* context{nullptr};
+            GPIOHandle chip_select_port{nullptr};
+            std::uint16_t chip_select_pin{};
+            std::array<std::uint8_t, 1UZ + MAX_TRANSFER_SIZE> tx_buffer{};
+            std::array<std::uint8_t, 1UZ + MAX_TRANSFER_SIZE> rx_buffer{};
+            std::atomic<TransferCallback> callback{nullptr};
+        };
+
+        std::array<Bus, 3UZ> buses{};
+
+        Bus* get_bus(SPIBusHandle const spi_bus) noexcept
+        {
+            if (spi_bus == nullptr) {
+                return nullptr;
+            } else if (spi_bus->Instance == SPI1) {
+                return &buses[0UZ];
+            } else if (spi_bus->Instance == SPI2) {
+                return &buses[1UZ];
+            } else if (spi_bus->Instance == SPI3) {
+                return &buses[2UZ];
+            }
+            return nullptr;
+        }
+
+        void finish_transfer(SPIBusHandle const spi_bus, bool const success) noexcept
+        {
+            auto* const bus = get_bus(spi_bus);
+            if (bus == nullptr) {
+                return;
+            }
+
+            HAL_GPIO_WritePin(bus->chip_select_port, bus->chip_select_pin, GPIO_PIN_SET);
+            bus->deselect_cycles = DWT->CYCCNT;
+
+            auto const callback = bus->callback.exchange(nullptr);
+            auto const bytes = bus->bytes;
+            auto* const context = bus->context;
+            if (callback != nullptr && success) {
+                std::copy_n(std::next(bus->rx_buffer.begin()), bytes.size(), bytes.begin());
+            }
+            bus->locked.store(false, std::memory_order_release);
+
+            if (callback != nullptr) {
+                callback(context, success ? bytes : std::span<std::uint8_t>{});
+            }
+        }
+
+        void start_cycle_counter() noexcept
+        {
+            CoreDebug->DEMCR = CoreDebug->DEMCR | CoreDebug_DEMCR_TRCENA_Msk;
+            DWT->CTRL = DWT->CTRL | DWT_CTRL_CYCCNTENA_Msk;
+        }
+
+    }; // namespace
+
+    SPIBusDevice::SPIBusDevice(SPIBusHandle const spi_bus,
+                               GPIOHandle const chip_select_port,
+                               std::uint16_t const chip_select_pin) noexcept :
+        spi_bus_{spi_bus}, chip_select_port_{chip_select_port}, chip_select_pin_{chip_select_pin}
+    {
+        start_cycle_counter();
+        this->deselect();
+    }
+
+    Expected<std::uint8_t> SPIBusDevice::read_byte(std::uint8_t const reg_address) const noexcept
+    {
+        auto byte = std::uint8_t{};
+        auto const result = this->read_bytes(reg_address, std::span{&byte, 1UZ});
+        return result.has_value() ? Expected<std::uint8_t>{byte}
+                                  : Expected<std::uint8_t>{::BusError::Unexpected{result.error()}};
+    }
+
+    Expected<void> SPIBusDevice::write_byte(std::uint8_t const reg_address, std::uint8_t const byte) const noexcept
+    {
+        return this->write_bytes(reg_address, std::span{&byte, 1UZ});
+    }
+
+    Expected<void> SPIBusDevice::read_bytes(std::uint8_t const reg_address,
+                                            std::span<std::uint8_t> const bytes) const noexcept
+    {
+        if (this->spi_bus_ == nullptr || this->chip_select_port_ == nullptr) {
+            return ::BusError::Unexpected{BusError::BUS_FAULT};
+        } else if (!this->lock()) {
+            return ::BusError::Unexpected{BusError::BUSY};
+        }
+
+        auto const command = make_command(reg_address, true, bytes.size());
+
+        this->select();
+        auto status = HAL_SPI_Transmit(this->spi_bus_, &command, 1U, TIMEOUT_MS);
+        if (status == HAL_OK) {
+            status =
+                HAL_SPI_Receive(this->spi_bus_, bytes.data(), static_cast<std::uint16_t>(bytes.size()), TIMEOUT_MS);
+        }
+        this->deselect();
+        this->unlock();
+
+        if (status != HAL_OK) {
+            return ::BusError::Unexpected{status_to_bus_error(status)};
+        }
+
+        return {};
+    }
+
+    Expected<void> SPIBusDevice::write_bytes(std::uint8_t const reg_address,
+                                             std::span<std::uint8_t const> const bytes) const noexcept
+    {
+        if (this->spi_bus_ == nullptr || this->chip_select_port_ == nullptr) {
+            return ::BusError::Unexpected{BusError::BUS_FAULT};
+        } else if (!this->lock()) {
+            return ::BusError::Unexpected{BusError::BUSY};
+        }
+
+        auto const command = make_command(reg_address, false, bytes.size());
+
+        this->select();
+        auto status = HAL_SPI_Transmit(this->spi_bus_, &command, 1U, TIMEOUT_MS);
+        if (status == HAL_OK) {
+            status =
+                HAL_SPI_Transmit(this->spi_bus_, bytes.data(), static_cast<std::uint16_t>(bytes.size()), TIMEOUT_MS);
+        }
+        this->deselect();
+        this->unlock();
+
+        if (status != HAL_OK) {
+            return ::BusError::Unexpected{status_to_bus_error(status)};
+        }
+
+        return {};
+    }
+
+    Expected<void> SPIBusDevice::read_bytes_dma(std::uint8_t const reg_address,
+                                                std::span<std::uint8_t> const bytes,
+                                                TransferCallback const callback,
+                                                void* const context) const noexcept
+    {
+        auto* const bus = get_bus(this->spi_bus_);
+        if (bus == nullptr || this->chip_select_port_ == nullptr || callback == nullptr || bytes.empty() ||
+            bytes.size() > MAX_TRANSFER_SIZE) {
+            return ::BusError::Unexpected{BusError::BUS_FAULT};
+        } else if (bus->locked.exchange(true, std::memory_order_acquire)) {
+            return ::BusError::Unexpected{BusError::BUSY};
+        }
+
+        bus->bytes = bytes;
+        bus->context = context;
+        bus->chip_select_port = this->chip_select_port_;
+        bus->chip_select_pin = this->chip_select_pin_;
+        bus->tx_buffer[0] = make_command(reg_address, true, bytes.size());
+        bus->callback.store(callback);
+
+        this->select();
+
+        if (auto const status = HAL_SPI_TransmitReceive_DMA(this->spi_bus_,
+                                                            bus->tx_buffer.data(),
+                                                            bus->rx_buffer.data(),
+                                                            static_cast<std::uint16_t>(1UZ + bytes.size()));
+            status != HAL_OK) {
+            this->deselect();
+            bus->callback.store(nullptr);
+            this->unlock();
+            return ::BusError::Unexpected{status_to_bus_error(status)};
+        }
+
+        return {};
+    }
+
+    bool SPIBusDevice::is_busy() const noexcept
+    {
+        auto const* const bus = get_bus(this->spi_bus_);
+        return bus != nullptr && bus->locked.load(std::memory_order_acquire);
+    }
+
+    void SPIBusDevice::transfer_complete_callback(SPIBusHandle const spi_bus) noexcept
+    {
+        finish_transfer(spi_bus, true);
+    }
+
+    void SPIBusDevice::transfer_error_callback(SPIBusHandle const spi_bus) noexcept
+    {
+        finish_transfer(spi_bus, false);
+    }
+
+    bool SPIBusDevice::lock() const noexcept
+    {
+        auto* const bus = get_bus(this->spi_bus_);
+        if (bus == nullptr) {
+            return false;
+        }
+
+        auto const start = HAL_GetTick();
+        while (bus->locked.exchange(true, std::memory_order_acquire)) {
+            if (HAL_GetTick() - start >= TIMEOUT_MS) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void SPIBusDevice::unlock() const noexcept
+    {
+        if (auto* const bus = get_bus(this->spi_bus_); bus != nullptr) {
+            bus->locked.store(false, std::memory_order_release);
+        }
+    }
+
+    void SPIBusDevice::select() const noexcept
+    {
+        if (auto const* const bus = get_bus(this->spi_bus_); bus != nullptr) {
+            auto const min_cycles = SystemCoreClock / 1'000'000U * MIN_DESELECT_TIME_US;
+            while (DWT->CYCCNT - bus->deselect_cycles < min_cycles) {
+            }
+        }
+        HAL_GPIO_WritePin(this->chip_select_port_, this->chip_select_pin_, GPIO_PIN_RESET);
+    }
+
+    void SPIBusDevice::deselect() const noexcept
+    {
+        if (this->chip_select_port_ != nullptr) {
+            HAL_GPIO_WritePin(this->chip_select_port_, this->chip_select_pin_, GPIO_PIN_SET);
+        }
+        if (auto* const bus = get_bus(this->spi_bus_); bus != nullptr) {
+            bus->deselect_cycles = DWT->CYCCNT;
+        }
+    }
+
+    std::uint8_t make_command(std::uint8_t const reg_address, bool const read, std::size_t const size) noexcept
+    {
+        return static_cast<std::uint8_t>((reg_address & 0x3FU) | (read ? READ_BIT : 0U) |
+                                         (size > 1UZ ? MULTI_BYTE_BIT : 0U));
+    }
+
+    BusError status_to_bus_error(HAL_StatusTypeDef const status) noexcept
+    {
+        if (status == HAL_BUSY) {
+            return BusError::BUSY;
+        } else if (status == HAL_TIMEOUT) {
+            return BusError::TIMEOUT;
+        }
+        return BusError::BUS_FAULT;
+    }
+
+}; // namespace SPIBusDevice
+
+extern "C" {
+
+    void HAL_SPI_TxRxCpltCallback(SPI_HandleTypeDef* hspi)
+    {
+        SPIBusDevice::SPIBusDevice::transfer_complete_callback(hspi);
+    }
+
+    void HAL_SPI_ErrorCallback(SPI_HandleTypeDef* hspi)
+    {
+        SPIBusDevice::SPIBusDevice::transfer_error_callback(hspi);
+    }
+}
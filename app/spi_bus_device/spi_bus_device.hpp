@@ -0,0 +1,86 @@
+#ifndef SPI_BUS_DEVICE_HPP
+#define SPI_BUS_DEVICE_HPP
+
+#include "bus_error.hpp"
+#include "stm32l4xx_hal.h"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace SPIBusDevice {
+
+    using SPIBusHandle = SPI_HandleTypeDef*;
+    using GPIOHandle = GPIO_TypeDef*;
+
+    using BusError = ::BusError::BusError;
+
+    template <typename T>
+    using Expected = ::BusError::Expected<T>;
+
+    using TransferCallback = void (*)(void* const context, std::span<std::uint8_t const> const bytes) noexcept;
+
+    std::uint32_t constexpr TIMEOUT_MS = 10U;
+
+    std::size_t constexpr MAX_TRANSFER_SIZE = 64UZ;
+
+    std::uint32_t constexpr MIN_DESELECT_TIME_US = 5U;
+
+    std::uint8_t constexpr READ_BIT = 0x80U;
+    std::uint8_t constexpr MULTI_BYTE_BIT = 0x40U;
+
+    struct SPIBusDevice {
+    public:
+        static bool constexpr FAST_BURST = true;
+
+        SPIBusDevice() noexcept = default;
+        SPIBusDevice(SPIBusHandle const spi_bus,
+                     GPIOHandle const chip_select_port,
+                     std::uint16_t const chip_select_pin) noexcept;
+
+        SPIBusDevice(SPIBusDevice const& other) noexcept = default;
+        SPIBusDevice(SPIBusDevice&& other) noexcept = default;
+
+        SPIBusDevice& operator=(SPIBusDevice const& other) noexcept = default;
+        SPIBusDevice& operator=(SPIBusDevice&& other) noexcept = default;
+
+        ~SPIBusDevice() noexcept = default;
+
+        Expected<void> read_bytes(std::uint8_t const reg_address, std::span<std::uint8_t> const bytes) const noexcept;
+
+        Expected<std::uint8_t> read_byte(std::uint8_t const reg_address) const noexcept;
+
+        Expected<void> write_bytes(std::uint8_t const reg_address,
+                                   std::span<std::uint8_t const> const bytes) const noexcept;
+
+        Expected<void> write_byte(std::uint8_t const reg_address, std::uint8_t const byte) const noexcept;
+
+        Expected<void> read_bytes_dma(std::uint8_t const reg_address,
+                                      std::span<std::uint8_t> const bytes,
+                                      TransferCallback const callback,
+                                      void* const context) const noexcept;
+
+        bool is_busy() const noexcept;
+
+        static void transfer_complete_callback(SPIBusHandle const spi_bus) noexcept;
+        static void transfer_error_callback(SPIBusHandle const spi_bus) noexcept;
+
+    private:
+        bool lock() const noexcept;
+        void unlock() const noexcept;
+
+        void select() const noexcept;
+        void deselect() const noexcept;
+
+        SPIBusHandle spi_bus_{nullptr};
+
+        GPIOHandle chip_select_port_{nullptr};
+        std::uint16_t chip_select_pin_{};
+    };
+
+    std::uint8_t make_command(std::uint8_t const reg_address, bool const read, std::size_t const size) noexcept;
+
+    BusError status_to_bus_error(HAL_StatusTypeDef const status) noexcept;
+
+}; // namespace SPIBusDevice
+
+#endif // SPI_BUS_DEVICE_HPP
@@ -0,0 +1,88 @@
+#include "timestamp_reconstructor.hpp"
+#include <cmath>
+
+namespace TimestampReconstructor {
+
+    TimestampReconstructor::TimestampReconstructor(std::uint32_t const tick_frequency,
+                                                   float const sample_rate,
+                                                   std::size_t const window) noexcept :
+        rate_estimator_{tick_frequency, sample_rate, window}
+    {}
+
+    void TimestampReconstructor::set_sample_rate(float const sample_rate) noexcept
+    {
+        this->rate_estimator_.set_nominal_rate(sample_rate);
+        this->anchor_valid_ = false;
+        this->last_valid_ = false;
+    }
+
+    void TimestampReconstructor::capture(std::uint32_t const timestamp, std::size_t const entries) noexcept
+    {
+        if (entries == 0UZ) {
+            return;
+        }
+
+        this->anchor_index_ = this->sample_index_ + entries - 1UZ;
+        this->anchor_timestamp_ = timestamp;
+        this->anchor_valid_ = true;
+
+        this->rate_estimator_.update(this->anchor_index_, this->anchor_timestamp_);
+    }
+
+    bool TimestampReconstructor::reconstruct(std::span<std::uint32_t> const timestamps) noexcept
+    {
+        if (!this->anchor_valid_) {
+            this->sample_index_ += timestamps.size();
+            return false;
+        }
+
+        auto const period = this->rate_estimator_.get_sample_period();
+        for (auto index = 0UZ; index < timestamps.size(); ++index) {
+            auto const distance = static_cast<std::int64_t>(this->sample_index_ + index) -
+                                  static_cast<std::int64_t>(this->anchor_index_);
+            auto const offset = std::llround(static_cast<float>(distance) * period);
+            timestamps[index] = this->anchor_timestamp_ + static_cast<std::uint32_t>(offset);
+        }
+
+        if (!timestamps.empty()) {
+            this->last_timestamp_ = timestamps.back();
+            this->last_valid_ = true;
+        }
+
+        this->sample_index_ += timestamps.size();
+        return true;
+    }
+
+    std::size_t TimestampReconstructor::recover(std::uint32_t const timestamp, std::size_t const entries) noexcept
+    {
+        auto lost = 0UZ;
+
+        auto const period = this->rate_estimator_.get_sample_period();
+        if (this->last_valid_ && period > 0.0F) {
+            auto const generated =
+                static_cast<std::size_t>(std::lround(static_cast<float>(timestamp - this->last_timestamp_) / period));
+            lost = generated > entries ? generated - entries : 0UZ;
+        }
+
+        this->sample_index_ += lost;
+        this->capture(timestamp, entries);
+        return lost;
+    }
+
+    void TimestampReconstructor::reset() noexcept
+    {
+        this->rate_estimator_.reset();
+        this->sample_index_ = 0U;
+        this->anchor_index_ = 0U;
+        this->anchor_timestamp_ = 0U;
+        this->anchor_valid_ = false;
+        this->last_timestamp_ = 0U;
+        this->last_valid_ = false;
+    }
+
+    RateEstimator::RateEstimator const& TimestampReconstructor::get_rate_estimator() const noexcept
+    {
+        return this->rate_estimator_;
+    }
+
+}; // namespace TimestampReconstructor
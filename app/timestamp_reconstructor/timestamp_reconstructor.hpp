@@ -0,0 +1,53 @@
+#ifndef TIMESTAMP_RECONSTRUCTOR_HPP
+#define TIMESTAMP_RECONSTRUCTOR_HPP
+
+#include "rate_estimator.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace TimestampReconstructor {
+
+    struct TimestampReconstructor {
+    public:
+        TimestampReconstructor() noexcept = default;
+        TimestampReconstructor(std::uint32_t const tick_frequency,
+                               float const sample_rate,
+                               std::size_t const window = RateEstimator::DEFAULT_WINDOW) noexcept;
+
+        TimestampReconstructor(TimestampReconstructor const& other) noexcept = default;
+        TimestampReconstructor(TimestampReconstructor&& other) noexcept = default;
+
+        TimestampReconstructor& operator=(TimestampReconstructor const& other) noexcept = default;
+        TimestampReconstructor& operator=(TimestampReconstructor&& other) noexcept = default;
+
+        ~TimestampReconstructor() noexcept = default;
+
+        void set_sample_rate(float const sample_rate) noexcept;
+
+        void capture(std::uint32_t const timestamp, std::size_t const entries) noexcept;
+
+        bool reconstruct(std::span<std::uint32_t> const timestamps) noexcept;
+
+        std::size_t recover(std::uint32_t const timestamp, std::size_t const entries) noexcept;
+
+        void reset() noexcept;
+
+        RateEstimator::RateEstimator const& get_rate_estimator() const noexcept;
+
+    private:
+        RateEstimator::RateEstimator rate_estimator_{};
+
+        std::uint64_t sample_index_{};
+
+        std::uint64_t anchor_index_{};
+        std::uint32_t anchor_timestamp_{};
+        bool anchor_valid_{false};
+
+        std::uint32_t last_timestamp_{};
+        bool last_valid_{false};
+    };
+
+}; // namespace TimestampReconstructor
+
+#endif // TIMESTAMP_RECONSTRUCTOR_HPP
@@ -0,0 +1,70 @@
+#ifndef UNIT_TEST_HPP
+#define UNIT_TEST_HPP
+
+#include <cstdio>
+#include <source_location>
+#include <utility>
+
+namespace UnitTest {
+
+    struct UnitTest {
+    public:
+        UnitTest() noexcept = default;
+        UnitTest(char const* const name) noexcept;
+
+        UnitTest(UnitTest const& other) = delete;
+        UnitTest(UnitTest&& other) = delete;
+
+        UnitTest& operator=(UnitTest const& other) = delete;
+        UnitTest& operator=(UnitTest&& other) = delete;
+
+        ~UnitTest() noexcept = default;
+
+        template <typename Test>
+        void run(char const* const test_name, Test&& test) noexcept;
+
+        bool expect(bool const condition,
+                    std::source_location const location = std::source_location::current()) noexcept;
+
+        int report() const noexcept;
+
+    private:
+        char const* name_{};
+        char const* test_name_{};
+
+        unsigned checks_{};
+        unsigned failures_{};
+    };
+
+    inline UnitTest::UnitTest(char const* const name) noexcept : name_{name}
+    {}
+
+    template <typename Test>
+    inline void UnitTest::run(char const* const test_name, Test&& test) noexcept
+    {
+        this->test_name_ = test_name;
+        std::forward<Test>(test)(*this);
+    }
+
+    inline bool UnitTest::expect(bool const condition, std::source_location const location) noexcept
+    {
+        ++this->checks_;
+        if (!condition) {
+            ++this->failures_;
+            std::printf("FAIL %s: %s:%u\n",
+                        this->test_name_,
+                        location.file_name(),
+                        static_cast<unsigned>(location.line()));
+        }
+        return condition;
+    }
+
+    inline int UnitTest::report() const noexcept
+    {
+        std::printf("%s: %u checks, %u failures\n", this->name_, this->checks_, this->failures_);
+        return this->failures_ == 0U ? 0 : 1;
+    }
+
+}; // namespace UnitTest
+
+#endif // UNIT_TEST_HPP
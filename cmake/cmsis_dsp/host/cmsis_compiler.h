@@ -0,0 +1,57 @@
+#ifndef CMSIS_COMPILER_H
+#define CMSIS_COMPILER_H
+
+/* Portable stand-in for the CMSIS core cmsis_compiler.h, used when CMSIS-DSP is built for the host. */
+
+#include <stdint.h>
+
+#define __STATIC_INLINE static inline
+#define __STATIC_FORCEINLINE __attribute__((always_inline)) static inline
+#define __ALIGNED(x) __attribute__((aligned(x)))
+
+#define LOW_OPTIMIZATION_ENTER
+#define LOW_OPTIMIZATION_EXIT
+#define IAR_ONLY_LOW_OPTIMIZATION_ENTER
+#define IAR_ONLY_LOW_OPTIMIZATION_EXIT
+
+__STATIC_FORCEINLINE uint8_t __CLZ(uint32_t value)
+{
+    return value == 0U ? 32U : (uint8_t)__builtin_clz(value);
+}
+
+__STATIC_FORCEINLINE uint32_t __ROR(uint32_t op1, uint32_t op2)
+{
+    op2 %= 32U;
+    return op2 == 0U ? op1 : (op1 >> op2) | (op1 << (32U - op2));
+}
+
+__STATIC_FORCEINLINE int32_t __SSAT(int32_t val, uint32_t sat)
+{
+    if (sat >= 1U && sat <= 32U) {
+        int32_t const max = (int32_t)((1U << (sat - 1U)) - 1U);
+        int32_t const min = -1 - max;
+        if (val > max) {
+            return max;
+        }
+        if (val < min) {
+            return min;
+        }
+    }
+    return val;
+}
+
+__STATIC_FORCEINLINE uint32_t __USAT(int32_t val, uint32_t sat)
+{
+    if (sat <= 31U) {
+        uint32_t const max = (1U << sat) - 1U;
+        if (val > (int32_t)max) {
+            return max;
+        }
+        if (val < 0) {
+            return 0U;
+        }
+    }
+    return (uint32_t)val;
+}
+
+#endif // CMSIS_COMPILER_H